@@ -174,7 +174,9 @@ namespace lemon {
         _min=i;
       } else {
         merge(i);
-        if( _comp(_data[i].prio, _data[_min].prio) ) _min=i;
+        // merge() may lace the old minimum under a root of equal priority,
+        // so the minimum is looked up again among the roots.
+        _min=findMin();
       }
       ++_num_items;
     }
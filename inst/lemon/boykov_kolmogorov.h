@@ -0,0 +1,821 @@
+/* -*- mode: C++; indent-tabs-mode: nil; -*-
+ *
+ * This file is a part of LEMON, a generic C++ optimization library.
+ *
+ * Copyright (C) 2003-2013
+ * Egervary Jeno Kombinatorikus Optimalizalasi Kutatocsoport
+ * (Egervary Research Group on Combinatorial Optimization, EGRES).
+ *
+ * Permission to use, modify and distribute this software is granted
+ * provided that this copyright notice appears in all copies. For
+ * precise terms see the accompanying LICENSE file.
+ *
+ * This software is provided "AS IS" with no warranty of any kind,
+ * express or implied, and with no claim as to its suitability for any
+ * purpose.
+ *
+ */
+
+#ifndef LEMON_BOYKOV_KOLMOGOROV_H
+#define LEMON_BOYKOV_KOLMOGOROV_H
+
+/// \file
+/// \ingroup max_flow
+/// \brief Implementation of the Boykov-Kolmogorov algorithm.
+
+#include <lemon/core.h>
+#include <lemon/tolerance.h>
+#include <deque>
+#include <limits>
+
+namespace lemon {
+
+  /// \brief Default traits class of BoykovKolmogorov class.
+  ///
+  /// Default traits class of BoykovKolmogorov class.
+  /// \param GR Digraph type.
+  /// \param CAP Type of capacity map.
+  template <typename GR, typename CAP>
+  struct BoykovKolmogorovDefaultTraits {
+
+    /// \brief The digraph type the algorithm runs on.
+    typedef GR Digraph;
+
+    /// \brief The type of the map that stores the arc capacities.
+    ///
+    /// The type of the map that stores the arc capacities.
+    /// It must meet the \ref concepts::ReadMap "ReadMap" concept.
+    typedef CAP CapacityMap;
+
+    /// \brief The type of the flow values.
+    typedef typename CapacityMap::Value Value;
+
+    /// \brief The type of the map that stores the terminal capacities.
+    ///
+    /// The type of the node map that stores the capacities between the
+    /// nodes and the terminals, when the algorithm is used with
+    /// terminal capacities instead of a source and a target node.
+    /// It must meet the \ref concepts::ReadMap "ReadMap" concept.
+#ifdef DOXYGEN
+    typedef GR::NodeMap<Value> TerminalMap;
+#else
+    typedef typename Digraph::template NodeMap<Value> TerminalMap;
+#endif
+
+    /// \brief The type of the map that stores the flow values.
+    ///
+    /// The type of the map that stores the flow values.
+    /// It must meet the \ref concepts::ReadWriteMap "ReadWriteMap" concept.
+#ifdef DOXYGEN
+    typedef GR::ArcMap<Value> FlowMap;
+#else
+    typedef typename Digraph::template ArcMap<Value> FlowMap;
+#endif
+
+    /// \brief Instantiates a FlowMap.
+    ///
+    /// This function instantiates a \ref FlowMap.
+    /// \param digraph The digraph for which we would like to define
+    /// the flow map.
+    static FlowMap* createFlowMap(const Digraph& digraph) {
+      return new FlowMap(digraph);
+    }
+
+    /// \brief The tolerance used by the algorithm
+    ///
+    /// The tolerance used by the algorithm to handle inexact computation.
+    typedef lemon::Tolerance<Value> Tolerance;
+
+  };
+
+  /// \ingroup max_flow
+  ///
+  /// \brief Boykov-Kolmogorov algorithm class.
+  ///
+  /// This class provides an implementation of the \e Boykov-Kolmogorov
+  /// \e algorithm producing a \ref max_flow "flow of maximum value" in a
+  /// digraph. The algorithm grows two search trees of residual paths,
+  /// one from the source and one from the target, and augments along the
+  /// path found where they meet. Instead of rebuilding the trees after an
+  /// augmentation, as the Edmonds-Karp algorithm does, it repairs them by
+  /// reattaching the nodes cut off by saturated arcs.
+  ///
+  /// Its worst case running time is \f$ O(nm^2|C|) \f$, where \f$ |C| \f$
+  /// is the value of the minimum cut, but on graphs with short augmenting
+  /// paths and many low degree nodes, like the grid graphs of image
+  /// segmentation problems, it is usually much faster than the Preflow
+  /// algorithm.
+  ///
+  /// Besides the usual source and target nodes, the algorithm can be
+  /// given \e terminal \e capacities: the capacity of an implicit arc
+  /// from the source to each node and from each node to the target. This
+  /// is the common form of graph cut problems, and it avoids the high
+  /// degree source and target nodes, so it can be used with graphs that
+  /// cannot be extended, like \ref GridGraph.
+  ///
+  /// The found minimum cut is the one whose source side is as small as
+  /// possible: it contains the nodes reachable from the source in the
+  /// residual digraph.
+  ///
+  /// \tparam GR The type of the digraph the algorithm runs on.
+  /// \tparam CAP The type of the capacity map. The default map
+  /// type is \ref concepts::Digraph::ArcMap "GR::ArcMap<int>".
+  /// \tparam TR The traits class that defines various types used by the
+  /// algorithm. By default, it is \ref BoykovKolmogorovDefaultTraits
+  /// "BoykovKolmogorovDefaultTraits<GR, CAP>".
+  /// In most cases, this parameter should not be set directly,
+  /// consider to use the named template parameters instead.
+
+#ifdef DOXYGEN
+  template <typename GR, typename CAP, typename TR>
+#else
+  template <typename GR,
+            typename CAP = typename GR::template ArcMap<int>,
+            typename TR = BoykovKolmogorovDefaultTraits<GR, CAP> >
+#endif
+  class BoykovKolmogorov {
+  public:
+
+    /// \brief The \ref lemon::BoykovKolmogorovDefaultTraits "traits class"
+    /// of the algorithm.
+    typedef TR Traits;
+    /// The type of the digraph the algorithm runs on.
+    typedef typename Traits::Digraph Digraph;
+    /// The type of the capacity map.
+    typedef typename Traits::CapacityMap CapacityMap;
+    /// The type of the flow values.
+    typedef typename Traits::Value Value;
+    /// The type of the terminal capacity maps.
+    typedef typename Traits::TerminalMap TerminalMap;
+
+    /// The type of the flow map.
+    typedef typename Traits::FlowMap FlowMap;
+    /// The type of the tolerance.
+    typedef typename Traits::Tolerance Tolerance;
+
+  private:
+
+    TEMPLATE_DIGRAPH_TYPEDEFS(Digraph);
+    typedef typename Digraph::template NodeMap<Value> ValueMap;
+    typedef typename Digraph::template NodeMap<Arc> ParentMap;
+    typedef typename Digraph::template NodeMap<char> CharMap;
+
+    // The tree a node belongs to.
+    enum { FREE = 0, SOURCE_TREE = 1, TARGET_TREE = 2 };
+    // How a tree node is linked to its parent.
+    enum { NO_LINK = 0, TERMINAL_LINK = 1, ORPHAN_LINK = 2, ARC_LINK = 3 };
+
+    const Digraph& _graph;
+    const CapacityMap* _capacity;
+
+    Node _source, _target;
+    const TerminalMap* _source_capacity;
+    const TerminalMap* _target_capacity;
+
+    FlowMap* _flow;
+    bool _local_flow;
+
+    // The residual capacities of the terminal arcs.
+    ValueMap* _source_residual;
+    ValueMap* _target_residual;
+
+    CharMap* _tree;
+    CharMap* _link;
+    CharMap* _active;
+    ParentMap* _parent;
+    // The time a node's distance to its terminal was last checked, and
+    // that distance.
+    IntNodeMap* _stamp;
+    IntNodeMap* _dist;
+    int _time;
+
+    std::deque<Node> _queue;
+    std::deque<Node> _orphans;
+
+    Tolerance _tolerance;
+    Value _flow_value;
+    Value _inf;
+
+    void createStructures() {
+      if (!_flow) {
+        _flow = Traits::createFlowMap(_graph);
+        _local_flow = true;
+      }
+      if (!_tree) {
+        _source_residual = new ValueMap(_graph);
+        _target_residual = new ValueMap(_graph);
+        _tree = new CharMap(_graph);
+        _link = new CharMap(_graph);
+        _active = new CharMap(_graph);
+        _parent = new ParentMap(_graph);
+        _stamp = new IntNodeMap(_graph);
+        _dist = new IntNodeMap(_graph);
+      }
+    }
+
+    void destroyStructures() {
+      if (_local_flow) {
+        delete _flow;
+      }
+      if (_tree) {
+        delete _source_residual;
+        delete _target_residual;
+        delete _tree;
+        delete _link;
+        delete _active;
+        delete _parent;
+        delete _stamp;
+        delete _dist;
+      }
+    }
+
+    // The node at the other end of the arc.
+    Node other(const Arc& arc, const Node& node) const {
+      Node s = _graph.source(arc);
+      return s == node ? _graph.target(arc) : s;
+    }
+
+    // The residual capacity of the arc, or of its reverse, leaving the
+    // given end node.
+    Value residual(const Arc& arc, const Node& from) const {
+      if (_graph.source(arc) == from) {
+        return (*_capacity)[arc] - (*_flow)[arc];
+      }
+      return (*_flow)[arc];
+    }
+
+    void push(const Arc& arc, const Node& from, const Value& delta) {
+      if (_graph.source(arc) == from) {
+        _flow->set(arc, (*_flow)[arc] + delta);
+      } else {
+        _flow->set(arc, (*_flow)[arc] - delta);
+      }
+    }
+
+    // The residual capacity of the link between a tree node and one of
+    // its neighbours, in the direction the flow takes in that tree.
+    Value treeResidual(const Arc& arc, const Node& node,
+                       const Node& neighbour) const {
+      if ((*_tree)[node] == SOURCE_TREE) {
+        return residual(arc, neighbour);
+      }
+      return residual(arc, node);
+    }
+
+    void activate(const Node& node) {
+      if (!(*_active)[node]) {
+        _active->set(node, true);
+        _queue.push_back(node);
+      }
+    }
+
+    Node nextActive() {
+      while (!_queue.empty()) {
+        Node node = _queue.front();
+        _queue.pop_front();
+        _active->set(node, false);
+        if ((*_tree)[node] != FREE) {
+          return node;
+        }
+      }
+      return INVALID;
+    }
+
+    void makeOrphan(const Node& node) {
+      _link->set(node, ORPHAN_LINK);
+      _orphans.push_front(node);
+    }
+
+    // Grows the tree of the node along the arc. Returns true if the arc
+    // reaches the other tree.
+    bool grow(const Node& node, const Arc& arc) {
+      Node next = other(arc, node);
+      if (next == node) {
+        return false;
+      }
+      int tree = (*_tree)[node];
+      Value rem = tree == SOURCE_TREE ? residual(arc, node)
+                                      : residual(arc, next);
+      if (!_tolerance.positive(rem)) {
+        return false;
+      }
+      if ((*_tree)[next] == FREE) {
+        _tree->set(next, tree);
+        _link->set(next, ARC_LINK);
+        _parent->set(next, arc);
+        _stamp->set(next, (*_stamp)[node]);
+        _dist->set(next, (*_dist)[node] + 1);
+        activate(next);
+        return false;
+      }
+      if ((*_tree)[next] != tree) {
+        return true;
+      }
+      // A shorter path to the terminal, through the node.
+      if ((*_link)[next] == ARC_LINK && (*_stamp)[next] <= (*_stamp)[node] &&
+          (*_dist)[next] > (*_dist)[node]) {
+        _parent->set(next, arc);
+        _stamp->set(next, (*_stamp)[node]);
+        _dist->set(next, (*_dist)[node] + 1);
+      }
+      return false;
+    }
+
+    // Augments along the path through the arc between the two trees.
+    void augment(const Arc& middle, const Node& node) {
+      Node s = node, t = other(middle, node);
+      if ((*_tree)[node] == TARGET_TREE) {
+        std::swap(s, t);
+      }
+
+      Value delta = residual(middle, s);
+      Node n = s;
+      while ((*_link)[n] == ARC_LINK) {
+        Arc arc = (*_parent)[n];
+        Node p = other(arc, n);
+        Value rem = residual(arc, p);
+        if (rem < delta) delta = rem;
+        n = p;
+      }
+      if ((*_source_residual)[n] < delta) delta = (*_source_residual)[n];
+      n = t;
+      while ((*_link)[n] == ARC_LINK) {
+        Arc arc = (*_parent)[n];
+        Value rem = residual(arc, n);
+        if (rem < delta) delta = rem;
+        n = other(arc, n);
+      }
+      if ((*_target_residual)[n] < delta) delta = (*_target_residual)[n];
+
+      push(middle, s, delta);
+      n = s;
+      while ((*_link)[n] == ARC_LINK) {
+        Arc arc = (*_parent)[n];
+        Node p = other(arc, n);
+        push(arc, p, delta);
+        if (!_tolerance.positive(residual(arc, p))) {
+          makeOrphan(n);
+        }
+        n = p;
+      }
+      if ((*_source_residual)[n] != _inf) {
+        _source_residual->set(n, (*_source_residual)[n] - delta);
+        if (!_tolerance.positive((*_source_residual)[n])) {
+          makeOrphan(n);
+        }
+      }
+      n = t;
+      while ((*_link)[n] == ARC_LINK) {
+        Arc arc = (*_parent)[n];
+        Node p = other(arc, n);
+        push(arc, n, delta);
+        if (!_tolerance.positive(residual(arc, n))) {
+          makeOrphan(n);
+        }
+        n = p;
+      }
+      if ((*_target_residual)[n] != _inf) {
+        _target_residual->set(n, (*_target_residual)[n] - delta);
+        if (!_tolerance.positive((*_target_residual)[n])) {
+          makeOrphan(n);
+        }
+      }
+
+      _flow_value += delta;
+    }
+
+    // Considers the neighbour along the arc as the new parent of the
+    // orphan, keeping the one closest to the terminal.
+    void checkParent(const Node& node, const Arc& arc, Arc& best,
+                     int& best_dist) {
+      Node next = other(arc, node);
+      if (next == node || (*_tree)[next] != (*_tree)[node] ||
+          !_tolerance.positive(treeResidual(arc, node, next))) {
+        return;
+      }
+      // Find the distance of the neighbour from its terminal, unless it
+      // descends from an orphan.
+      int d = 0;
+      Node n = next;
+      while (true) {
+        if ((*_stamp)[n] == _time) {
+          d += (*_dist)[n];
+          break;
+        }
+        ++d;
+        if ((*_link)[n] == TERMINAL_LINK) {
+          _stamp->set(n, _time);
+          _dist->set(n, 1);
+          break;
+        }
+        if ((*_link)[n] == ORPHAN_LINK) {
+          return;
+        }
+        n = other((*_parent)[n], n);
+      }
+      if (d < best_dist) {
+        best = arc;
+        best_dist = d;
+      }
+      // Mark the distances along the path.
+      for (n = next; (*_stamp)[n] != _time; n = other((*_parent)[n], n)) {
+        _stamp->set(n, _time);
+        _dist->set(n, d--);
+      }
+    }
+
+    // Detaches the neighbour along the arc from the freed orphan.
+    void releaseNeighbour(const Node& node, const Arc& arc, int tree) {
+      Node next = other(arc, node);
+      if (next == node || (*_tree)[next] != tree) {
+        return;
+      }
+      Value rem = tree == SOURCE_TREE ? residual(arc, next)
+                                      : residual(arc, node);
+      if (_tolerance.positive(rem)) {
+        activate(next);
+      }
+      if ((*_link)[next] == ARC_LINK &&
+          other((*_parent)[next], next) == node) {
+        _link->set(next, ORPHAN_LINK);
+        _orphans.push_back(next);
+      }
+    }
+
+    // Finds a new parent for each orphan, or frees it.
+    void adopt() {
+      while (!_orphans.empty()) {
+        Node node = _orphans.front();
+        _orphans.pop_front();
+
+        Arc best = INVALID;
+        int best_dist = std::numeric_limits<int>::max();
+        for (OutArcIt a(_graph, node); a != INVALID; ++a) {
+          checkParent(node, a, best, best_dist);
+        }
+        for (InArcIt a(_graph, node); a != INVALID; ++a) {
+          checkParent(node, a, best, best_dist);
+        }
+
+        if (best != INVALID) {
+          _link->set(node, ARC_LINK);
+          _parent->set(node, best);
+          _stamp->set(node, _time);
+          _dist->set(node, best_dist + 1);
+          continue;
+        }
+
+        int tree = (*_tree)[node];
+        _tree->set(node, FREE);
+        _link->set(node, NO_LINK);
+        for (OutArcIt a(_graph, node); a != INVALID; ++a) {
+          releaseNeighbour(node, a, tree);
+        }
+        for (InArcIt a(_graph, node); a != INVALID; ++a) {
+          releaseNeighbour(node, a, tree);
+        }
+      }
+    }
+
+  public:
+
+    typedef BoykovKolmogorov Create;
+
+    ///\name Named template parameters
+
+    ///@{
+
+    template <typename T>
+    struct SetFlowMapTraits : public Traits {
+      typedef T FlowMap;
+      static FlowMap *createFlowMap(const Digraph&) {
+        LEMON_ASSERT(false, "FlowMap is not initialized");
+        return 0;
+      }
+    };
+
+    /// \brief \ref named-templ-param "Named parameter" for setting
+    /// FlowMap type
+    ///
+    /// \ref named-templ-param "Named parameter" for setting FlowMap
+    /// type
+    template <typename T>
+    struct SetFlowMap
+      : public BoykovKolmogorov<Digraph, CapacityMap, SetFlowMapTraits<T> > {
+      typedef BoykovKolmogorov<Digraph, CapacityMap,
+                               SetFlowMapTraits<T> > Create;
+    };
+
+    /// @}
+
+  protected:
+
+    BoykovKolmogorov() {}
+
+  public:
+
+    /// \brief The constructor of the class.
+    ///
+    /// The constructor of the class.
+    /// \param digraph The digraph the algorithm runs on.
+    /// \param capacity The capacity of the arcs.
+    /// \param source The source node.
+    /// \param target The target node.
+    BoykovKolmogorov(const Digraph& digraph, const CapacityMap& capacity,
+                     Node source, Node target)
+      : _graph(digraph), _capacity(&capacity), _source(source),
+        _target(target), _source_capacity(0), _target_capacity(0),
+        _flow(0), _local_flow(false), _source_residual(0),
+        _target_residual(0), _tree(0), _link(0), _active(0), _parent(0),
+        _stamp(0), _dist(0), _time(0), _tolerance(), _flow_value()
+    {
+      LEMON_ASSERT(_source != _target,
+                   "Flow source and target are the same nodes.");
+    }
+
+    /// \brief The constructor of the class for terminal capacities.
+    ///
+    /// The constructor of the class, for a flow from an implicit source
+    /// to an implicit target. Each node is connected to the source and
+    /// to the target by arcs of the given capacities.
+    /// \param digraph The digraph the algorithm runs on.
+    /// \param capacity The capacity of the arcs.
+    /// \param sourceCapacity The capacity of the arc from the source to
+    /// each node.
+    /// \param targetCapacity The capacity of the arc from each node to
+    /// the target.
+    BoykovKolmogorov(const Digraph& digraph, const CapacityMap& capacity,
+                     const TerminalMap& sourceCapacity,
+                     const TerminalMap& targetCapacity)
+      : _graph(digraph), _capacity(&capacity), _source(INVALID),
+        _target(INVALID), _source_capacity(&sourceCapacity),
+        _target_capacity(&targetCapacity), _flow(0), _local_flow(false),
+        _source_residual(0), _target_residual(0), _tree(0), _link(0),
+        _active(0), _parent(0), _stamp(0), _dist(0), _time(0),
+        _tolerance(), _flow_value() {}
+
+    /// \brief Destructor.
+    ///
+    /// Destructor.
+    ~BoykovKolmogorov() {
+      destroyStructures();
+    }
+
+    /// \brief Sets the capacity map.
+    ///
+    /// Sets the capacity map.
+    /// \return <tt>(*this)</tt>
+    BoykovKolmogorov& capacityMap(const CapacityMap& map) {
+      _capacity = &map;
+      return *this;
+    }
+
+    /// \brief Sets the flow map.
+    ///
+    /// Sets the flow map.
+    /// If you don't use this function before calling \ref run() or
+    /// \ref init(), an instance will be allocated automatically.
+    /// The destructor deallocates this automatically allocated map,
+    /// of course.
+    /// \return <tt>(*this)</tt>
+    BoykovKolmogorov& flowMap(FlowMap& map) {
+      if (_local_flow) {
+        delete _flow;
+        _local_flow = false;
+      }
+      _flow = &map;
+      return *this;
+    }
+
+    /// \brief Sets the tolerance used by algorithm.
+    ///
+    /// Sets the tolerance used by algorithm.
+    /// \return <tt>(*this)</tt>
+    BoykovKolmogorov& tolerance(const Tolerance& tolerance) {
+      _tolerance = tolerance;
+      return *this;
+    }
+
+    /// \brief Returns a const reference to the tolerance.
+    ///
+    /// Returns a const reference to the tolerance object used by
+    /// the algorithm.
+    const Tolerance& tolerance() const {
+      return _tolerance;
+    }
+
+    /// \name Execution control
+    /// The simplest way to execute the algorithm is to use \ref run().\n
+    /// If you need more control on the execution, first you have to call
+    /// \ref init(), then \ref start().
+
+    ///@{
+
+    /// \brief Initializes the algorithm.
+    ///
+    /// Initializes the internal data structures and sets the initial
+    /// flow to zero on each arc. With terminal capacities, the flow
+    /// through the nodes connected to both terminals is sent at once.
+    void init() {
+      createStructures();
+      for (ArcIt a(_graph); a != INVALID; ++a) {
+        _flow->set(a, 0);
+      }
+      _inf = std::numeric_limits<Value>::has_infinity ?
+        std::numeric_limits<Value>::infinity() :
+        std::numeric_limits<Value>::max();
+      _flow_value = 0;
+      _time = 0;
+      _queue.clear();
+      _orphans.clear();
+
+      for (NodeIt n(_graph); n != INVALID; ++n) {
+        Value sc = 0, tc = 0;
+        if (_source_capacity) {
+          sc = (*_source_capacity)[n];
+          tc = (*_target_capacity)[n];
+          Value d = sc < tc ? sc : tc;
+          if (_tolerance.positive(d)) {
+            _flow_value += d;
+            sc -= d;
+            tc -= d;
+          }
+        } else if (n == _source) {
+          sc = _inf;
+        } else if (n == _target) {
+          tc = _inf;
+        }
+        _source_residual->set(n, sc);
+        _target_residual->set(n, tc);
+        _active->set(n, false);
+        _stamp->set(n, 0);
+        _dist->set(n, 1);
+        if (_tolerance.positive(sc)) {
+          _tree->set(n, SOURCE_TREE);
+          _link->set(n, TERMINAL_LINK);
+          activate(n);
+        } else if (_tolerance.positive(tc)) {
+          _tree->set(n, TARGET_TREE);
+          _link->set(n, TERMINAL_LINK);
+          activate(n);
+        } else {
+          _tree->set(n, FREE);
+          _link->set(n, NO_LINK);
+        }
+      }
+    }
+
+    /// \brief Executes the algorithm.
+    ///
+    /// Executes the algorithm by growing the search trees and augmenting
+    /// along the paths found between them until the trees cannot grow.
+    /// \pre \ref init() must be called before using this function.
+    void start() {
+      Node current = INVALID;
+      while (true) {
+        if (current != INVALID && (*_tree)[current] == FREE) {
+          current = INVALID;
+        }
+        Node node = current != INVALID ? current : nextActive();
+        if (node == INVALID) break;
+
+        Arc middle = INVALID;
+        for (OutArcIt a(_graph, node); a != INVALID; ++a) {
+          if (grow(node, a)) {
+            middle = a;
+            break;
+          }
+        }
+        if (middle == INVALID) {
+          for (InArcIt a(_graph, node); a != INVALID; ++a) {
+            if (grow(node, a)) {
+              middle = a;
+              break;
+            }
+          }
+        }
+
+        ++_time;
+        if (middle != INVALID) {
+          current = node;
+          augment(middle, node);
+          adopt();
+        } else {
+          current = INVALID;
+        }
+      }
+    }
+
+    /// \brief Runs the algorithm.
+    ///
+    /// Runs the Boykov-Kolmogorov algorithm.
+    /// \note bk.run() is just a shortcut of the following code.
+    ///\code
+    /// bk.init();
+    /// bk.start();
+    ///\endcode
+    void run() {
+      init();
+      start();
+    }
+
+    /// @}
+
+    /// \name Query Functions
+    /// The result of the Boykov-Kolmogorov algorithm can be obtained using
+    /// these functions.\n
+    /// Either \ref run() or \ref start() should be called before using them.
+
+    ///@{
+
+    /// \brief Returns the value of the maximum flow.
+    ///
+    /// Returns the value of the maximum flow found by the algorithm.
+    ///
+    /// \pre Either \ref run() or \ref init() must be called before
+    /// using this function.
+    Value flowValue() const {
+      return _flow_value;
+    }
+
+    /// \brief Returns the flow value on the given arc.
+    ///
+    /// Returns the flow value on the given arc.
+    ///
+    /// \pre Either \ref run() or \ref init() must be called before
+    /// using this function.
+    Value flow(const Arc& arc) const {
+      return (*_flow)[arc];
+    }
+
+    /// \brief Returns a const reference to the flow map.
+    ///
+    /// Returns a const reference to the arc map storing the found flow.
+    ///
+    /// \pre Either \ref run() or \ref init() must be called before
+    /// using this function.
+    const FlowMap& flowMap() const {
+      return *_flow;
+    }
+
+    /// \brief Returns the flow from the source to the given node.
+    ///
+    /// Returns the flow on the terminal arc from the source to the given
+    /// node.
+    ///
+    /// \pre The algorithm must be constructed with terminal capacities,
+    /// and either \ref run() or \ref init() must be called before
+    /// using this function.
+    Value sourceFlow(const Node& node) const {
+      return (*_source_capacity)[node] - (*_source_residual)[node];
+    }
+
+    /// \brief Returns the flow from the given node to the target.
+    ///
+    /// Returns the flow on the terminal arc from the given node to the
+    /// target.
+    ///
+    /// \pre The algorithm must be constructed with terminal capacities,
+    /// and either \ref run() or \ref init() must be called before
+    /// using this function.
+    Value targetFlow(const Node& node) const {
+      return (*_target_capacity)[node] - (*_target_residual)[node];
+    }
+
+    /// \brief Returns \c true when the node is on the source side of the
+    /// minimum cut.
+    ///
+    /// Returns true when the node is on the source side of the found
+    /// minimum cut.
+    ///
+    /// \pre Either \ref run() or \ref init() must be called before
+    /// using this function.
+    bool minCut(const Node& node) const {
+      return (*_tree)[node] == SOURCE_TREE;
+    }
+
+    /// \brief Gives back a minimum value cut.
+    ///
+    /// Sets \c cutMap to the characteristic vector of a minimum value
+    /// cut. \c cutMap should be a \ref concepts::WriteMap "writable"
+    /// node map with \c bool (or convertible) value type.
+    ///
+    /// \note This function calls \ref minCut() for each node, so it runs in
+    /// O(n) time.
+    ///
+    /// \pre Either \ref run() or \ref init() must be called before
+    /// using this function.
+    template <typename CutMap>
+    void minCutMap(CutMap& cutMap) const {
+      for (NodeIt n(_graph); n != INVALID; ++n) {
+        cutMap.set(n, minCut(n));
+      }
+    }
+
+    /// @}
+
+  };
+
+}
+
+#endif
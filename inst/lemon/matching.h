@@ -799,6 +799,7 @@ namespace lemon {
 
     Value _delta_sum;
     int _unmatched;
+    int _step_num, _augment_num;
 
     typedef MaxWeightedFractionalMatching<Graph, WeightMap> FractionalMatching;
     FractionalMatching *_fractional;
@@ -1583,7 +1584,7 @@ namespace lemon {
         _delta3_index(0), _delta3(0),
         _delta4_index(0), _delta4(0),
 
-        _delta_sum(), _unmatched(0),
+        _delta_sum(), _unmatched(0), _step_num(0), _augment_num(0),
 
         _fractional(0)
     {}
@@ -1818,18 +1819,161 @@ namespace lemon {
       }
     }
 
+    /// \brief Initialize the algorithm with a greedy matching
+    ///
+    /// This function initializes the algorithm with the dual solution
+    /// of \ref init(), in which each node has half the weight of its
+    /// heaviest edge, and matches every edge which is the heaviest at
+    /// both of its ends, as these are tight. Only the nodes left
+    /// unmatched start search trees. This is cheaper than
+    /// \ref fractionalInit(), but usually leaves more nodes unmatched.
+    void greedyInit() {
+      createStructures();
+
+      _blossom_node_list.clear();
+      _blossom_potential.clear();
+
+      for (ArcIt e(_graph); e != INVALID; ++e) {
+        (*_node_heap_index)[e] = BinHeap<Value, IntArcMap>::PRE_HEAP;
+      }
+      for (NodeIt n(_graph); n != INVALID; ++n) {
+        (*_delta1_index)[n] = _delta1->PRE_HEAP;
+      }
+      for (EdgeIt e(_graph); e != INVALID; ++e) {
+        (*_delta3_index)[e] = _delta3->PRE_HEAP;
+      }
+      for (int i = 0; i < _blossom_num; ++i) {
+        (*_delta2_index)[i] = _delta2->PRE_HEAP;
+        (*_delta4_index)[i] = _delta4->PRE_HEAP;
+      }
+
+      _unmatched = 0;
+
+      _delta1->clear();
+      _delta2->clear();
+      _delta3->clear();
+      _delta4->clear();
+      _blossom_set->clear();
+      _tree_set->clear();
+
+      int index = 0;
+      for (NodeIt n(_graph); n != INVALID; ++n) {
+        Value max = 0;
+        for (OutArcIt e(_graph, n); e != INVALID; ++e) {
+          if (_graph.target(e) == n) continue;
+          if ((dualScale * _weight[e]) / 2 > max) {
+            max = (dualScale * _weight[e]) / 2;
+          }
+        }
+        (*_node_index)[n] = index;
+        (*_node_data)[index].heap_index.clear();
+        (*_node_data)[index].heap.clear();
+        (*_node_data)[index].pot = max;
+        ++index;
+      }
+
+      typename Graph::template NodeMap<Arc> mate(_graph, INVALID);
+      for (NodeIt n(_graph); n != INVALID; ++n) {
+        if (mate[n] != INVALID) continue;
+        int ni = (*_node_index)[n];
+        for (OutArcIt e(_graph, n); e != INVALID; ++e) {
+          Node v = _graph.target(e);
+          if (v == n || mate[v] != INVALID || _weight[e] <= 0) continue;
+          int vi = (*_node_index)[v];
+          if ((*_node_data)[ni].pot + (*_node_data)[vi].pot ==
+              dualScale * _weight[e]) {
+            mate[n] = e;
+            mate[v] = _graph.oppositeArc(e);
+            break;
+          }
+        }
+      }
+
+      for (NodeIt n(_graph); n != INVALID; ++n) {
+        int blossom =
+          _blossom_set->insert(n, std::numeric_limits<Value>::max());
+
+        (*_blossom_data)[blossom].pred = INVALID;
+        (*_blossom_data)[blossom].next = mate[n];
+        (*_blossom_data)[blossom].pot = 0;
+        (*_blossom_data)[blossom].offset = 0;
+        if (mate[n] != INVALID) {
+          (*_blossom_data)[blossom].status = MATCHED;
+        } else {
+          (*_blossom_data)[blossom].status = EVEN;
+          _delta1->push(n, (*_node_data)[(*_node_index)[n]].pot);
+          _tree_set->insert(blossom);
+          ++_unmatched;
+        }
+      }
+
+      for (EdgeIt e(_graph); e != INVALID; ++e) {
+        int si = (*_node_index)[_graph.u(e)];
+        int sb = _blossom_set->find(_graph.u(e));
+        int ti = (*_node_index)[_graph.v(e)];
+        int tb = _blossom_set->find(_graph.v(e));
+        if ((*_blossom_data)[sb].status == EVEN &&
+            (*_blossom_data)[tb].status == EVEN && sb != tb) {
+          _delta3->push(e, ((*_node_data)[si].pot + (*_node_data)[ti].pot -
+                            dualScale * _weight[e]) / 2);
+        }
+      }
+
+      for (NodeIt n(_graph); n != INVALID; ++n) {
+        int nb = _blossom_set->find(n);
+        if ((*_blossom_data)[nb].status != MATCHED) continue;
+        int ni = (*_node_index)[n];
+
+        for (OutArcIt e(_graph, n); e != INVALID; ++e) {
+          Node v = _graph.target(e);
+          int vb = _blossom_set->find(v);
+          int vi = (*_node_index)[v];
+
+          Value rw = (*_node_data)[ni].pot + (*_node_data)[vi].pot -
+            dualScale * _weight[e];
+
+          if ((*_blossom_data)[vb].status == EVEN) {
+
+            int vt = _tree_set->find(vb);
+
+            typename std::map<int, Arc>::iterator it =
+              (*_node_data)[ni].heap_index.find(vt);
+
+            if (it != (*_node_data)[ni].heap_index.end()) {
+              if ((*_node_data)[ni].heap[it->second] > rw) {
+                (*_node_data)[ni].heap.replace(it->second, e);
+                (*_node_data)[ni].heap.decrease(e, rw);
+                it->second = e;
+              }
+            } else {
+              (*_node_data)[ni].heap.push(e, rw);
+              (*_node_data)[ni].heap_index.insert(std::make_pair(vt, e));
+            }
+          }
+        }
+
+        if (!(*_node_data)[ni].heap.empty()) {
+          _blossom_set->decrease(n, (*_node_data)[ni].heap.prio());
+          _delta2->push(nb, _blossom_set->classPrio(nb));
+        }
+      }
+    }
+
     /// \brief Start the algorithm
     ///
     /// This function starts the algorithm.
     ///
-    /// \pre \ref init() or \ref fractionalInit() must be called
-    /// before using this function.
+    /// \pre \ref init(), \ref fractionalInit() or \ref greedyInit()
+    /// must be called before using this function.
     void start() {
       enum OpType {
         D1, D2, D3, D4
       };
 
+      _step_num = 0;
+      _augment_num = 0;
       while (_unmatched > 0) {
+        ++_step_num;
         Value d1 = !_delta1->empty() ?
           _delta1->prio() : std::numeric_limits<Value>::max();
 
@@ -1863,6 +2007,7 @@ namespace lemon {
             if ((*_blossom_data)[blossom].next == INVALID) {
               augmentOnArc(a);
               --_unmatched;
+              ++_augment_num;
             } else {
               extendOnArc(a);
             }
@@ -1886,6 +2031,7 @@ namespace lemon {
               } else {
                 augmentOnEdge(e);
                 _unmatched -= 2;
+                ++_augment_num;
               }
             }
           } break;
@@ -1951,6 +2097,29 @@ namespace lemon {
       return num /= 2;
     }
 
+    /// \brief Return the number of steps of the algorithm.
+    ///
+    /// This function returns the number of dual updates made by the
+    /// last \ref start(), each followed by growing a search tree,
+    /// shrinking or expanding a blossom, augmenting the matching, or
+    /// leaving a node unmatched.
+    ///
+    /// \pre Either run() or start() must be called before using this function.
+    int stepNum() const {
+      return _step_num;
+    }
+
+    /// \brief Return the number of augmentations of the algorithm.
+    ///
+    /// This function returns the number of times the last \ref start()
+    /// augmented the matching, that is, the number of its phases which
+    /// ended in an augmentation.
+    ///
+    /// \pre Either run() or start() must be called before using this function.
+    int augmentNum() const {
+      return _augment_num;
+    }
+
     /// \brief Return \c true if the given edge is in the matching.
     ///
     /// This function returns \c true if the given edge is in the found
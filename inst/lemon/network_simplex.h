@@ -229,6 +229,7 @@ namespace lemon {
     CharVector _state;
     IntVector _dirty_revs;
     int _root;
+    bool _basis_ready;
 
     // Temporary data used in the current pivot iteration
     int in_arc, join, u_in, v_in, u_out, v_out;
@@ -834,6 +835,38 @@ namespace lemon {
       return start(pivot_rule);
     }
 
+    /// \brief Run the algorithm again from the last spanning tree.
+    ///
+    /// This function runs the algorithm like \ref run(), but it starts
+    /// from the spanning tree structure (basis) found by the last
+    /// \ref run() or \ref rerun() call instead of the artificial initial
+    /// basis. It is intended for solving a sequence of related problems,
+    /// in which only the upper bounds, costs and supply values are
+    /// modified between the calls; if the modifications are small, it is
+    /// usually much faster than solving each problem from scratch.
+    ///
+    /// The flow on the tree arcs is recomputed for the new parameters, and
+    /// the subtrees whose tree arc would leave its bounds are attached to
+    /// the root by artificial arcs, so the algorithm starts from a valid
+    /// strongly feasible basis.
+    ///
+    /// If there is no usable basis, namely if \ref run() has not been
+    /// called since the construction of the class or the last \ref reset()
+    /// call, if lower bounds are given, or if the sum of the supply values
+    /// is not zero (in this or in the last run), the problem is solved
+    /// from scratch using \ref run().
+    ///
+    /// \param pivot_rule The pivot rule that will be used during the
+    /// algorithm. For more information, see \ref PivotRule.
+    ///
+    /// \return The same as for \ref run().
+    ///
+    /// \see run()
+    ProblemType rerun(PivotRule pivot_rule = BLOCK_SEARCH) {
+      if (!warmInit()) return run(pivot_rule);
+      return start(pivot_rule);
+    }
+
     /// \brief Reset all the parameters that have been given before.
     ///
     /// This function resets all the paramaters that have been given
@@ -957,6 +990,7 @@ namespace lemon {
       }
 
       // Reset parameters
+      _basis_ready = false;
       resetParams();
       return *this;
     }
@@ -1055,8 +1089,24 @@ namespace lemon {
 
   private:
 
+    // Compute the cost of the artificial arcs
+    Cost artificialCost() const {
+      Cost art_cost;
+      if (std::numeric_limits<Cost>::is_exact) {
+        art_cost = std::numeric_limits<Cost>::max() / 2 + 1;
+      } else {
+        art_cost = 0;
+        for (int i = 0; i != _arc_num; ++i) {
+          if (_cost[i] > art_cost) art_cost = _cost[i];
+        }
+        art_cost = (art_cost + 1) * _node_num;
+      }
+      return art_cost;
+    }
+
     // Initialize internal data structures
     bool init() {
+      _basis_ready = false;
       if (_node_num == 0) return false;
 
       // Check the sum of supply values
@@ -1090,16 +1140,7 @@ namespace lemon {
       }
 
       // Initialize artifical cost
-      Cost ART_COST;
-      if (std::numeric_limits<Cost>::is_exact) {
-        ART_COST = std::numeric_limits<Cost>::max() / 2 + 1;
-      } else {
-        ART_COST = 0;
-        for (int i = 0; i != _arc_num; ++i) {
-          if (_cost[i] > ART_COST) ART_COST = _cost[i];
-        }
-        ART_COST = (ART_COST + 1) * _node_num;
-      }
+      Cost ART_COST = artificialCost();
 
       // Initialize arc maps
       for (int i = 0; i != _arc_num; ++i) {
@@ -1235,6 +1276,128 @@ namespace lemon {
       return true;
     }
 
+    // Initialize the internal data structures from the spanning tree of
+    // the last run, for the modified parameters. Return false if the
+    // last basis cannot be used, without changing any data.
+    bool warmInit() {
+      if (!_basis_ready || _has_lower || _sum_supply != 0) return false;
+
+      // Only EQ supply constraints are handled, as the artificial arcs
+      // of the other cases depend on the signs of the supply values
+      Value sum_supply = 0;
+      for (int i = 0; i != _node_num; ++i) {
+        sum_supply += _supply[i];
+      }
+      if (sum_supply != 0) return false;
+      for (int i = 0; i != _arc_num; ++i) {
+        if (_state[i] == STATE_UPPER && _upper[i] >= MAX) return false;
+      }
+
+      Cost ART_COST = artificialCost();
+      for (int i = 0; i != _arc_num; ++i) {
+        _cap[i] = _upper[i];
+      }
+      _supply[_root] = 0;
+
+      // Set the flow on the non-tree arcs and the excess they leave at
+      // each node
+      ValueVector excess(_node_num + 1, 0);
+      for (int u = 0; u != _node_num; ++u) {
+        excess[u] = _supply[u];
+      }
+      for (int e = 0; e != _all_arc_num; ++e) {
+        if (_state[e] == STATE_TREE) continue;
+        Value f = _state[e] == STATE_UPPER ? _cap[e] : 0;
+        _flow[e] = f;
+        excess[_source[e]] -= f;
+        excess[_target[e]] += f;
+      }
+
+      // Compute the flow on the tree arcs bottom-up. If the flow on the
+      // tree arc of a node would violate its bounds or the strong
+      // feasibility of the tree (i.e. a positive amount of flow could not
+      // be sent from the node towards the root), the arc is fixed at one
+      // of its bounds and the subtree of the node is attached directly to
+      // the root by its artificial arc, as in init().
+      for (int u = _rev_thread[_root]; u != _root; u = _rev_thread[u]) {
+        int e = _pred[u];
+        if (e < _arc_num) {
+          Value f = _pred_dir[u] == DIR_UP ? excess[u] : -excess[u];
+          bool feasible = _pred_dir[u] == DIR_UP ?
+            f >= 0 && f < _cap[e] : f > 0 && f <= _cap[e];
+          if (feasible) {
+            _flow[e] = f;
+            excess[_parent[u]] += excess[u];
+            continue;
+          }
+          Value b = f > 0 ? _cap[e] : 0;
+          _flow[e] = b;
+          _state[e] = b == 0 ? STATE_LOWER : STATE_UPPER;
+          Value c = _pred_dir[u] == DIR_UP ? b : -b;
+          excess[_parent[u]] += c;
+          excess[u] -= c;
+          e = _arc_num + u;
+          _parent[u] = _root;
+          _pred[u] = e;
+          _state[e] = STATE_TREE;
+        }
+        if (excess[u] >= 0) {
+          _source[e] = u;
+          _target[e] = _root;
+          _flow[e] = excess[u];
+          _cost[e] = 0;
+          _pred_dir[u] = DIR_UP;
+        } else {
+          _source[e] = _root;
+          _target[e] = u;
+          _flow[e] = -excess[u];
+          _cost[e] = ART_COST;
+          _pred_dir[u] = DIR_DOWN;
+        }
+      }
+
+      // Rebuild the thread and the successor data of the tree
+      IntVector first_child(_node_num + 1, -1);
+      IntVector next_sibling(_node_num + 1, -1);
+      for (int u = _node_num - 1; u >= 0; --u) {
+        next_sibling[u] = first_child[_parent[u]];
+        first_child[_parent[u]] = u;
+      }
+      IntVector stack(1, _root);
+      int last = -1;
+      while (!stack.empty()) {
+        int u = stack.back();
+        stack.pop_back();
+        if (last != -1) {
+          _thread[last] = u;
+          _rev_thread[u] = last;
+        }
+        last = u;
+        for (int v = first_child[u]; v != -1; v = next_sibling[v]) {
+          stack.push_back(v);
+        }
+      }
+      _thread[last] = _root;
+      _rev_thread[_root] = last;
+      for (int u = 0; u != _node_num + 1; ++u) {
+        _succ_num[u] = 1;
+        _last_succ[u] = u;
+      }
+      for (int u = _rev_thread[_root]; u != _root; u = _rev_thread[u]) {
+        int p = _parent[u];
+        if (_last_succ[p] == p) _last_succ[p] = _last_succ[u];
+        _succ_num[p] += _succ_num[u];
+      }
+
+      // Compute the node potentials for the tree
+      _pi[_root] = 0;
+      for (int u = _thread[_root]; u != _root; u = _thread[u]) {
+        _pi[u] = _pi[_parent[u]] - _pred_dir[u] * _cost[_pred[u]];
+      }
+
+      return true;
+    }
+
     // Check if the upper bound is greater than or equal to the lower bound
     // on each arc.
     bool checkBoundMaps() {
@@ -1590,6 +1753,7 @@ namespace lemon {
     template <typename PivotRuleImpl>
     ProblemType start() {
       PivotRuleImpl pivot(*this);
+      _basis_ready = true;
 
       // Perform heuristic initial pivots
       if (!initialPivots()) return UNBOUNDED;
@@ -1,6 +1,8 @@
 #include "approximation.h"
 #include "connectivity.h"
+#include "contraction_hierarchy.h"
 #include "convert.h"
+#include "graph_handle.h"
 #include "graph_search.h"
 #include "max_flow.h"
 #include "max_matching.h"
@@ -8,9 +10,11 @@
 #include "min_cut.h"
 #include "min_mean_cycle.h"
 #include "min_span_tree.h"
+#include "parallel.h"
 #include "planarity_embedding.h"
 #include "shortest_path.h"
 #include "travelling_salesperson.h"
+#include "value_type.h"
 #include <Rcpp.h>
 #include <tuple>
 using namespace Rcpp;
@@ -218,6 +218,19 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// GraphProfileRunner
+Rcpp::List GraphProfileRunner(std::vector<int> arcSources, std::vector<int> arcTargets, int numNodes);
+RcppExport SEXP _rlemon_GraphProfileRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP numNodesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    rcpp_result_gen = Rcpp::wrap(GraphProfileRunner(arcSources, arcTargets, numNodes));
+    return rcpp_result_gen;
+END_RCPP
+}
 // CountBiEdgeConnectedComponentsRunner
 int CountBiEdgeConnectedComponentsRunner(std::vector<int> arcSources, std::vector<int> arcTargets, int numNodes);
 RcppExport SEXP _rlemon_CountBiEdgeConnectedComponentsRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP numNodesSEXP) {
@@ -283,6 +296,60 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// PearceComponentsRunner
+std::vector<int> PearceComponentsRunner(std::vector<int> arcSources, std::vector<int> arcTargets, int numNodes);
+RcppExport SEXP _rlemon_PearceComponentsRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP numNodesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    rcpp_result_gen = Rcpp::wrap(PearceComponentsRunner(arcSources, arcTargets, numNodes));
+    return rcpp_result_gen;
+END_RCPP
+}
+// ColoringComponentsRunner
+std::vector<int> ColoringComponentsRunner(std::vector<int> arcSources, std::vector<int> arcTargets, int numNodes, int numThreads);
+RcppExport SEXP _rlemon_ColoringComponentsRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP numNodesSEXP, SEXP numThreadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    Rcpp::traits::input_parameter< int >::type numThreads(numThreadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(ColoringComponentsRunner(arcSources, arcTargets, numNodes, numThreads));
+    return rcpp_result_gen;
+END_RCPP
+}
+// PearceComponentCountRunner
+int PearceComponentCountRunner(std::vector<int> arcSources, std::vector<int> arcTargets, int numNodes);
+RcppExport SEXP _rlemon_PearceComponentCountRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP numNodesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    rcpp_result_gen = Rcpp::wrap(PearceComponentCountRunner(arcSources, arcTargets, numNodes));
+    return rcpp_result_gen;
+END_RCPP
+}
+// ColoringComponentCountRunner
+int ColoringComponentCountRunner(std::vector<int> arcSources, std::vector<int> arcTargets, int numNodes, int numThreads);
+RcppExport SEXP _rlemon_ColoringComponentCountRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP numNodesSEXP, SEXP numThreadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    Rcpp::traits::input_parameter< int >::type numThreads(numThreadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(ColoringComponentCountRunner(arcSources, arcTargets, numNodes, numThreads));
+    return rcpp_result_gen;
+END_RCPP
+}
 // FindStronglyConnectedCutArcsRunner
 Rcpp::List FindStronglyConnectedCutArcsRunner(std::vector<int> arcSources, std::vector<int> arcTargets, int numNodes);
 RcppExport SEXP _rlemon_FindStronglyConnectedCutArcsRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP numNodesSEXP) {
@@ -348,6 +415,34 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// UnionFindComponentsRunner
+std::vector<int> UnionFindComponentsRunner(std::vector<int> arcSources, std::vector<int> arcTargets, int numNodes, int numThreads);
+RcppExport SEXP _rlemon_UnionFindComponentsRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP numNodesSEXP, SEXP numThreadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    Rcpp::traits::input_parameter< int >::type numThreads(numThreadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(UnionFindComponentsRunner(arcSources, arcTargets, numNodes, numThreads));
+    return rcpp_result_gen;
+END_RCPP
+}
+// UnionFindComponentCountRunner
+int UnionFindComponentCountRunner(std::vector<int> arcSources, std::vector<int> arcTargets, int numNodes, int numThreads);
+RcppExport SEXP _rlemon_UnionFindComponentCountRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP numNodesSEXP, SEXP numThreadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    Rcpp::traits::input_parameter< int >::type numThreads(numThreadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(UnionFindComponentCountRunner(arcSources, arcTargets, numNodes, numThreads));
+    return rcpp_result_gen;
+END_RCPP
+}
 // FindBiEdgeConnectedComponentsRunner
 std::vector<int> FindBiEdgeConnectedComponentsRunner(std::vector<int> arcSources, std::vector<int> arcTargets, int numNodes);
 RcppExport SEXP _rlemon_FindBiEdgeConnectedComponentsRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP numNodesSEXP) {
@@ -361,6 +456,63 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// ContractionHierarchyRunner
+SEXP ContractionHierarchyRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int numNodes);
+RcppExport SEXP _rlemon_ContractionHierarchyRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP numNodesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    rcpp_result_gen = Rcpp::wrap(ContractionHierarchyRunner(arcSources, arcTargets, arcDistances, numNodes));
+    return rcpp_result_gen;
+END_RCPP
+}
+// ContractionHierarchyQueryRunner
+Rcpp::List ContractionHierarchyQueryRunner(SEXP index, std::vector<int> startNodes, std::vector<int> endNodes, bool paths, int numThreads);
+RcppExport SEXP _rlemon_ContractionHierarchyQueryRunner(SEXP indexSEXP, SEXP startNodesSEXP, SEXP endNodesSEXP, SEXP pathsSEXP, SEXP numThreadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type index(indexSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type startNodes(startNodesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type endNodes(endNodesSEXP);
+    Rcpp::traits::input_parameter< bool >::type paths(pathsSEXP);
+    Rcpp::traits::input_parameter< int >::type numThreads(numThreadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(ContractionHierarchyQueryRunner(index, startNodes, endNodes, paths, numThreads));
+    return rcpp_result_gen;
+END_RCPP
+}
+// ContractionHierarchyExportRunner
+Rcpp::List ContractionHierarchyExportRunner(SEXP index);
+RcppExport SEXP _rlemon_ContractionHierarchyExportRunner(SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type index(indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(ContractionHierarchyExportRunner(index));
+    return rcpp_result_gen;
+END_RCPP
+}
+// ContractionHierarchyImportRunner
+SEXP ContractionHierarchyImportRunner(int numNodes, std::vector<int> rank, std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcWeights, std::vector<int> arcFirst, std::vector<int> arcSecond);
+RcppExport SEXP _rlemon_ContractionHierarchyImportRunner(SEXP numNodesSEXP, SEXP rankSEXP, SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcWeightsSEXP, SEXP arcFirstSEXP, SEXP arcSecondSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type rank(rankSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcWeights(arcWeightsSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcFirst(arcFirstSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSecond(arcSecondSEXP);
+    rcpp_result_gen = Rcpp::wrap(ContractionHierarchyImportRunner(numNodes, rank, arcSources, arcTargets, arcWeights, arcFirst, arcSecond));
+    return rcpp_result_gen;
+END_RCPP
+}
 // GraphCompatabilityConverter
 Rcpp::List GraphCompatabilityConverter(std::vector<int> nodesList, std::vector<int> arcSources, std::vector<int> arcTargets);
 RcppExport SEXP _rlemon_GraphCompatabilityConverter(SEXP nodesListSEXP, SEXP arcSourcesSEXP, SEXP arcTargetsSEXP) {
@@ -374,6 +526,19 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// GraphHandleRunner
+SEXP GraphHandleRunner(std::vector<int> arcSources, std::vector<int> arcTargets, int numNodes);
+RcppExport SEXP _rlemon_GraphHandleRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP numNodesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    rcpp_result_gen = Rcpp::wrap(GraphHandleRunner(arcSources, arcTargets, numNodes));
+    return rcpp_result_gen;
+END_RCPP
+}
 // BfsRunner
 Rcpp::List BfsRunner(std::vector<int> arcSources, std::vector<int> arcTargets, int numNodes, int startNode, int endNode);
 RcppExport SEXP _rlemon_BfsRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP numNodesSEXP, SEXP startNodeSEXP, SEXP endNodeSEXP) {
@@ -389,6 +554,19 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// BfsGraphRunner
+Rcpp::List BfsGraphRunner(SEXP graph, int startNode, int endNode);
+RcppExport SEXP _rlemon_BfsGraphRunner(SEXP graphSEXP, SEXP startNodeSEXP, SEXP endNodeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< int >::type startNode(startNodeSEXP);
+    Rcpp::traits::input_parameter< int >::type endNode(endNodeSEXP);
+    rcpp_result_gen = Rcpp::wrap(BfsGraphRunner(graph, startNode, endNode));
+    return rcpp_result_gen;
+END_RCPP
+}
 // DfsRunner
 Rcpp::List DfsRunner(std::vector<int> arcSources, std::vector<int> arcTargets, int numNodes, int startNode, int endNode);
 RcppExport SEXP _rlemon_DfsRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP numNodesSEXP, SEXP startNodeSEXP, SEXP endNodeSEXP) {
@@ -404,15 +582,28 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// DfsGraphRunner
+Rcpp::List DfsGraphRunner(SEXP graph, int startNode, int endNode);
+RcppExport SEXP _rlemon_DfsGraphRunner(SEXP graphSEXP, SEXP startNodeSEXP, SEXP endNodeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< int >::type startNode(startNodeSEXP);
+    Rcpp::traits::input_parameter< int >::type endNode(endNodeSEXP);
+    rcpp_result_gen = Rcpp::wrap(DfsGraphRunner(graph, startNode, endNode));
+    return rcpp_result_gen;
+END_RCPP
+}
 // MaxCardinalitySearchRunner
-Rcpp::List MaxCardinalitySearchRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcCapacities, int numNodes, int startNode);
+Rcpp::List MaxCardinalitySearchRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcCapacities, int numNodes, int startNode);
 RcppExport SEXP _rlemon_MaxCardinalitySearchRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcCapacitiesSEXP, SEXP numNodesSEXP, SEXP startNodeSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcCapacities(arcCapacitiesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCapacities(arcCapacitiesSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
     Rcpp::traits::input_parameter< int >::type startNode(startNodeSEXP);
     rcpp_result_gen = Rcpp::wrap(MaxCardinalitySearchRunner(arcSources, arcTargets, arcCapacities, numNodes, startNode));
@@ -420,30 +611,44 @@ BEGIN_RCPP
 END_RCPP
 }
 // CirculationRunner
-Rcpp::List CirculationRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcLowerBound, std::vector<int> arcUpperBound, std::vector<int> nodeSupplies, int numNodes);
+Rcpp::List CirculationRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcLowerBound, std::vector<double> arcUpperBound, std::vector<double> nodeSupplies, int numNodes);
 RcppExport SEXP _rlemon_CirculationRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcLowerBoundSEXP, SEXP arcUpperBoundSEXP, SEXP nodeSuppliesSEXP, SEXP numNodesSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcLowerBound(arcLowerBoundSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcUpperBound(arcUpperBoundSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type nodeSupplies(nodeSuppliesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcLowerBound(arcLowerBoundSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcUpperBound(arcUpperBoundSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type nodeSupplies(nodeSuppliesSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
     rcpp_result_gen = Rcpp::wrap(CirculationRunner(arcSources, arcTargets, arcLowerBound, arcUpperBound, nodeSupplies, numNodes));
     return rcpp_result_gen;
 END_RCPP
 }
+// CirculationGraphRunner
+Rcpp::List CirculationGraphRunner(SEXP graph, std::vector<double> arcLowerBound, std::vector<double> arcUpperBound, std::vector<double> nodeSupplies);
+RcppExport SEXP _rlemon_CirculationGraphRunner(SEXP graphSEXP, SEXP arcLowerBoundSEXP, SEXP arcUpperBoundSEXP, SEXP nodeSuppliesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcLowerBound(arcLowerBoundSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcUpperBound(arcUpperBoundSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type nodeSupplies(nodeSuppliesSEXP);
+    rcpp_result_gen = Rcpp::wrap(CirculationGraphRunner(graph, arcLowerBound, arcUpperBound, nodeSupplies));
+    return rcpp_result_gen;
+END_RCPP
+}
 // PreflowRunner
-Rcpp::List PreflowRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcDistances, int sourceNode, int destinationNode, int numNodes);
+Rcpp::List PreflowRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int sourceNode, int destinationNode, int numNodes);
 RcppExport SEXP _rlemon_PreflowRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP sourceNodeSEXP, SEXP destinationNodeSEXP, SEXP numNodesSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
     Rcpp::traits::input_parameter< int >::type sourceNode(sourceNodeSEXP);
     Rcpp::traits::input_parameter< int >::type destinationNode(destinationNodeSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
@@ -451,15 +656,63 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// PreflowGraphRunner
+Rcpp::List PreflowGraphRunner(SEXP graph, std::vector<double> arcDistances, int sourceNode, int destinationNode);
+RcppExport SEXP _rlemon_PreflowGraphRunner(SEXP graphSEXP, SEXP arcDistancesSEXP, SEXP sourceNodeSEXP, SEXP destinationNodeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type sourceNode(sourceNodeSEXP);
+    Rcpp::traits::input_parameter< int >::type destinationNode(destinationNodeSEXP);
+    rcpp_result_gen = Rcpp::wrap(PreflowGraphRunner(graph, arcDistances, sourceNode, destinationNode));
+    return rcpp_result_gen;
+END_RCPP
+}
+// PreflowBatchRunner
+Rcpp::List PreflowBatchRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, std::vector<int> sourceNodes, std::vector<int> destinationNodes, int numNodes, bool cuts, int numThreads);
+RcppExport SEXP _rlemon_PreflowBatchRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP sourceNodesSEXP, SEXP destinationNodesSEXP, SEXP numNodesSEXP, SEXP cutsSEXP, SEXP numThreadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type sourceNodes(sourceNodesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type destinationNodes(destinationNodesSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    Rcpp::traits::input_parameter< bool >::type cuts(cutsSEXP);
+    Rcpp::traits::input_parameter< int >::type numThreads(numThreadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(PreflowBatchRunner(arcSources, arcTargets, arcDistances, sourceNodes, destinationNodes, numNodes, cuts, numThreads));
+    return rcpp_result_gen;
+END_RCPP
+}
+// PreflowBatchGraphRunner
+Rcpp::List PreflowBatchGraphRunner(SEXP graph, std::vector<double> arcDistances, std::vector<int> sourceNodes, std::vector<int> destinationNodes, bool cuts, int numThreads);
+RcppExport SEXP _rlemon_PreflowBatchGraphRunner(SEXP graphSEXP, SEXP arcDistancesSEXP, SEXP sourceNodesSEXP, SEXP destinationNodesSEXP, SEXP cutsSEXP, SEXP numThreadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type sourceNodes(sourceNodesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type destinationNodes(destinationNodesSEXP);
+    Rcpp::traits::input_parameter< bool >::type cuts(cutsSEXP);
+    Rcpp::traits::input_parameter< int >::type numThreads(numThreadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(PreflowBatchGraphRunner(graph, arcDistances, sourceNodes, destinationNodes, cuts, numThreads));
+    return rcpp_result_gen;
+END_RCPP
+}
 // EdmondsKarpRunner
-Rcpp::List EdmondsKarpRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcDistances, int sourceNode, int destinationNode, int numNodes);
+Rcpp::List EdmondsKarpRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int sourceNode, int destinationNode, int numNodes);
 RcppExport SEXP _rlemon_EdmondsKarpRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP sourceNodeSEXP, SEXP destinationNodeSEXP, SEXP numNodesSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
     Rcpp::traits::input_parameter< int >::type sourceNode(sourceNodeSEXP);
     Rcpp::traits::input_parameter< int >::type destinationNode(destinationNodeSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
@@ -467,59 +720,191 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// EdmondsKarpGraphRunner
+Rcpp::List EdmondsKarpGraphRunner(SEXP graph, std::vector<double> arcDistances, int sourceNode, int destinationNode);
+RcppExport SEXP _rlemon_EdmondsKarpGraphRunner(SEXP graphSEXP, SEXP arcDistancesSEXP, SEXP sourceNodeSEXP, SEXP destinationNodeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type sourceNode(sourceNodeSEXP);
+    Rcpp::traits::input_parameter< int >::type destinationNode(destinationNodeSEXP);
+    rcpp_result_gen = Rcpp::wrap(EdmondsKarpGraphRunner(graph, arcDistances, sourceNode, destinationNode));
+    return rcpp_result_gen;
+END_RCPP
+}
+// ParallelPreflowRunner
+Rcpp::List ParallelPreflowRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int sourceNode, int destinationNode, int numNodes, int numThreads);
+RcppExport SEXP _rlemon_ParallelPreflowRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP sourceNodeSEXP, SEXP destinationNodeSEXP, SEXP numNodesSEXP, SEXP numThreadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type sourceNode(sourceNodeSEXP);
+    Rcpp::traits::input_parameter< int >::type destinationNode(destinationNodeSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    Rcpp::traits::input_parameter< int >::type numThreads(numThreadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(ParallelPreflowRunner(arcSources, arcTargets, arcDistances, sourceNode, destinationNode, numNodes, numThreads));
+    return rcpp_result_gen;
+END_RCPP
+}
+// ParallelPreflowGraphRunner
+Rcpp::List ParallelPreflowGraphRunner(SEXP graph, std::vector<double> arcDistances, int sourceNode, int destinationNode, int numThreads);
+RcppExport SEXP _rlemon_ParallelPreflowGraphRunner(SEXP graphSEXP, SEXP arcDistancesSEXP, SEXP sourceNodeSEXP, SEXP destinationNodeSEXP, SEXP numThreadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type sourceNode(sourceNodeSEXP);
+    Rcpp::traits::input_parameter< int >::type destinationNode(destinationNodeSEXP);
+    Rcpp::traits::input_parameter< int >::type numThreads(numThreadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(ParallelPreflowGraphRunner(graph, arcDistances, sourceNode, destinationNode, numThreads));
+    return rcpp_result_gen;
+END_RCPP
+}
+// BoykovKolmogorovRunner
+Rcpp::List BoykovKolmogorovRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int sourceNode, int destinationNode, int numNodes);
+RcppExport SEXP _rlemon_BoykovKolmogorovRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP sourceNodeSEXP, SEXP destinationNodeSEXP, SEXP numNodesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type sourceNode(sourceNodeSEXP);
+    Rcpp::traits::input_parameter< int >::type destinationNode(destinationNodeSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    rcpp_result_gen = Rcpp::wrap(BoykovKolmogorovRunner(arcSources, arcTargets, arcDistances, sourceNode, destinationNode, numNodes));
+    return rcpp_result_gen;
+END_RCPP
+}
+// BoykovKolmogorovGraphRunner
+Rcpp::List BoykovKolmogorovGraphRunner(SEXP graph, std::vector<double> arcDistances, int sourceNode, int destinationNode);
+RcppExport SEXP _rlemon_BoykovKolmogorovGraphRunner(SEXP graphSEXP, SEXP arcDistancesSEXP, SEXP sourceNodeSEXP, SEXP destinationNodeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type sourceNode(sourceNodeSEXP);
+    Rcpp::traits::input_parameter< int >::type destinationNode(destinationNodeSEXP);
+    rcpp_result_gen = Rcpp::wrap(BoykovKolmogorovGraphRunner(graph, arcDistances, sourceNode, destinationNode));
+    return rcpp_result_gen;
+END_RCPP
+}
+// GridBoykovKolmogorovRunner
+Rcpp::List GridBoykovKolmogorovRunner(std::vector<double> sourceCapacities, std::vector<double> destCapacities, std::vector<double> horizontalCapacities, std::vector<double> verticalCapacities, int numRows, int numCols);
+RcppExport SEXP _rlemon_GridBoykovKolmogorovRunner(SEXP sourceCapacitiesSEXP, SEXP destCapacitiesSEXP, SEXP horizontalCapacitiesSEXP, SEXP verticalCapacitiesSEXP, SEXP numRowsSEXP, SEXP numColsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<double> >::type sourceCapacities(sourceCapacitiesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type destCapacities(destCapacitiesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type horizontalCapacities(horizontalCapacitiesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type verticalCapacities(verticalCapacitiesSEXP);
+    Rcpp::traits::input_parameter< int >::type numRows(numRowsSEXP);
+    Rcpp::traits::input_parameter< int >::type numCols(numColsSEXP);
+    rcpp_result_gen = Rcpp::wrap(GridBoykovKolmogorovRunner(sourceCapacities, destCapacities, horizontalCapacities, verticalCapacities, numRows, numCols));
+    return rcpp_result_gen;
+END_RCPP
+}
+// PreflowSolverRunner
+SEXP PreflowSolverRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcCapacities, int sourceNode, int destinationNode, int numNodes);
+RcppExport SEXP _rlemon_PreflowSolverRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcCapacitiesSEXP, SEXP sourceNodeSEXP, SEXP destinationNodeSEXP, SEXP numNodesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCapacities(arcCapacitiesSEXP);
+    Rcpp::traits::input_parameter< int >::type sourceNode(sourceNodeSEXP);
+    Rcpp::traits::input_parameter< int >::type destinationNode(destinationNodeSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    rcpp_result_gen = Rcpp::wrap(PreflowSolverRunner(arcSources, arcTargets, arcCapacities, sourceNode, destinationNode, numNodes));
+    return rcpp_result_gen;
+END_RCPP
+}
+// PreflowSolverUpdateRunner
+void PreflowSolverUpdateRunner(SEXP solver, std::vector<int> arcs, std::vector<double> capacityDeltas);
+RcppExport SEXP _rlemon_PreflowSolverUpdateRunner(SEXP solverSEXP, SEXP arcsSEXP, SEXP capacityDeltasSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type solver(solverSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcs(arcsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type capacityDeltas(capacityDeltasSEXP);
+    PreflowSolverUpdateRunner(solver, arcs, capacityDeltas);
+    return R_NilValue;
+END_RCPP
+}
+// PreflowSolverSolveRunner
+Rcpp::List PreflowSolverSolveRunner(SEXP solver);
+RcppExport SEXP _rlemon_PreflowSolverSolveRunner(SEXP solverSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type solver(solverSEXP);
+    rcpp_result_gen = Rcpp::wrap(PreflowSolverSolveRunner(solver));
+    return rcpp_result_gen;
+END_RCPP
+}
 // MaximumWeightPerfectMatchingRunner
-Rcpp::List MaximumWeightPerfectMatchingRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcWeights, int numNodes);
+Rcpp::List MaximumWeightPerfectMatchingRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcWeights, int numNodes);
 RcppExport SEXP _rlemon_MaximumWeightPerfectMatchingRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcWeightsSEXP, SEXP numNodesSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcWeights(arcWeightsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcWeights(arcWeightsSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
     rcpp_result_gen = Rcpp::wrap(MaximumWeightPerfectMatchingRunner(arcSources, arcTargets, arcWeights, numNodes));
     return rcpp_result_gen;
 END_RCPP
 }
 // MaximumWeightFractionalPerfectMatchingRunner
-Rcpp::List MaximumWeightFractionalPerfectMatchingRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcWeights, int numNodes);
+Rcpp::List MaximumWeightFractionalPerfectMatchingRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcWeights, int numNodes);
 RcppExport SEXP _rlemon_MaximumWeightFractionalPerfectMatchingRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcWeightsSEXP, SEXP numNodesSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcWeights(arcWeightsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcWeights(arcWeightsSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
     rcpp_result_gen = Rcpp::wrap(MaximumWeightFractionalPerfectMatchingRunner(arcSources, arcTargets, arcWeights, numNodes));
     return rcpp_result_gen;
 END_RCPP
 }
 // MaximumWeightFractionalMatchingRunner
-Rcpp::List MaximumWeightFractionalMatchingRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcWeights, int numNodes);
+Rcpp::List MaximumWeightFractionalMatchingRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcWeights, int numNodes);
 RcppExport SEXP _rlemon_MaximumWeightFractionalMatchingRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcWeightsSEXP, SEXP numNodesSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcWeights(arcWeightsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcWeights(arcWeightsSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
     rcpp_result_gen = Rcpp::wrap(MaximumWeightFractionalMatchingRunner(arcSources, arcTargets, arcWeights, numNodes));
     return rcpp_result_gen;
 END_RCPP
 }
 // MaximumWeightMatchingRunner
-Rcpp::List MaximumWeightMatchingRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcWeights, int numNodes);
-RcppExport SEXP _rlemon_MaximumWeightMatchingRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcWeightsSEXP, SEXP numNodesSEXP) {
+Rcpp::List MaximumWeightMatchingRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcWeights, int numNodes, std::string init);
+RcppExport SEXP _rlemon_MaximumWeightMatchingRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcWeightsSEXP, SEXP numNodesSEXP, SEXP initSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcWeights(arcWeightsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcWeights(arcWeightsSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
-    rcpp_result_gen = Rcpp::wrap(MaximumWeightMatchingRunner(arcSources, arcTargets, arcWeights, numNodes));
+    Rcpp::traits::input_parameter< std::string >::type init(initSEXP);
+    rcpp_result_gen = Rcpp::wrap(MaximumWeightMatchingRunner(arcSources, arcTargets, arcWeights, numNodes, init));
     return rcpp_result_gen;
 END_RCPP
 }
@@ -549,183 +934,391 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// HungarianRunner
+Rcpp::List HungarianRunner(Rcpp::NumericMatrix costs, bool maximize);
+RcppExport SEXP _rlemon_HungarianRunner(SEXP costsSEXP, SEXP maximizeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericMatrix >::type costs(costsSEXP);
+    Rcpp::traits::input_parameter< bool >::type maximize(maximizeSEXP);
+    rcpp_result_gen = Rcpp::wrap(HungarianRunner(costs, maximize));
+    return rcpp_result_gen;
+END_RCPP
+}
 // CycleCancellingRunner
-Rcpp::List CycleCancellingRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcCapacities, std::vector<int> arcCosts, std::vector<int> nodeSupplies, int numNodes);
+Rcpp::List CycleCancellingRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcCapacities, std::vector<double> arcCosts, std::vector<double> nodeSupplies, int numNodes);
 RcppExport SEXP _rlemon_CycleCancellingRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcCapacitiesSEXP, SEXP arcCostsSEXP, SEXP nodeSuppliesSEXP, SEXP numNodesSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcCapacities(arcCapacitiesSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcCosts(arcCostsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type nodeSupplies(nodeSuppliesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCapacities(arcCapacitiesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCosts(arcCostsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type nodeSupplies(nodeSuppliesSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
     rcpp_result_gen = Rcpp::wrap(CycleCancellingRunner(arcSources, arcTargets, arcCapacities, arcCosts, nodeSupplies, numNodes));
     return rcpp_result_gen;
 END_RCPP
 }
+// CycleCancellingGraphRunner
+Rcpp::List CycleCancellingGraphRunner(SEXP graph, std::vector<double> arcCapacities, std::vector<double> arcCosts, std::vector<double> nodeSupplies);
+RcppExport SEXP _rlemon_CycleCancellingGraphRunner(SEXP graphSEXP, SEXP arcCapacitiesSEXP, SEXP arcCostsSEXP, SEXP nodeSuppliesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCapacities(arcCapacitiesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCosts(arcCostsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type nodeSupplies(nodeSuppliesSEXP);
+    rcpp_result_gen = Rcpp::wrap(CycleCancellingGraphRunner(graph, arcCapacities, arcCosts, nodeSupplies));
+    return rcpp_result_gen;
+END_RCPP
+}
 // CapacityScalingRunner
-Rcpp::List CapacityScalingRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcCapacities, std::vector<int> arcCosts, std::vector<int> nodeSupplies, int numNodes);
+Rcpp::List CapacityScalingRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcCapacities, std::vector<double> arcCosts, std::vector<double> nodeSupplies, int numNodes);
 RcppExport SEXP _rlemon_CapacityScalingRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcCapacitiesSEXP, SEXP arcCostsSEXP, SEXP nodeSuppliesSEXP, SEXP numNodesSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcCapacities(arcCapacitiesSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcCosts(arcCostsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type nodeSupplies(nodeSuppliesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCapacities(arcCapacitiesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCosts(arcCostsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type nodeSupplies(nodeSuppliesSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
     rcpp_result_gen = Rcpp::wrap(CapacityScalingRunner(arcSources, arcTargets, arcCapacities, arcCosts, nodeSupplies, numNodes));
     return rcpp_result_gen;
 END_RCPP
 }
+// CapacityScalingGraphRunner
+Rcpp::List CapacityScalingGraphRunner(SEXP graph, std::vector<double> arcCapacities, std::vector<double> arcCosts, std::vector<double> nodeSupplies);
+RcppExport SEXP _rlemon_CapacityScalingGraphRunner(SEXP graphSEXP, SEXP arcCapacitiesSEXP, SEXP arcCostsSEXP, SEXP nodeSuppliesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCapacities(arcCapacitiesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCosts(arcCostsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type nodeSupplies(nodeSuppliesSEXP);
+    rcpp_result_gen = Rcpp::wrap(CapacityScalingGraphRunner(graph, arcCapacities, arcCosts, nodeSupplies));
+    return rcpp_result_gen;
+END_RCPP
+}
 // CostScalingRunner
-Rcpp::List CostScalingRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcCapacities, std::vector<int> arcCosts, std::vector<int> nodeSupplies, int numNodes);
-RcppExport SEXP _rlemon_CostScalingRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcCapacitiesSEXP, SEXP arcCostsSEXP, SEXP nodeSuppliesSEXP, SEXP numNodesSEXP) {
+Rcpp::List CostScalingRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcCapacities, std::vector<double> arcCosts, std::vector<double> nodeSupplies, int numNodes, std::string method);
+RcppExport SEXP _rlemon_CostScalingRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcCapacitiesSEXP, SEXP arcCostsSEXP, SEXP nodeSuppliesSEXP, SEXP numNodesSEXP, SEXP methodSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcCapacities(arcCapacitiesSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcCosts(arcCostsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type nodeSupplies(nodeSuppliesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCapacities(arcCapacitiesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCosts(arcCostsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type nodeSupplies(nodeSuppliesSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
-    rcpp_result_gen = Rcpp::wrap(CostScalingRunner(arcSources, arcTargets, arcCapacities, arcCosts, nodeSupplies, numNodes));
+    Rcpp::traits::input_parameter< std::string >::type method(methodSEXP);
+    rcpp_result_gen = Rcpp::wrap(CostScalingRunner(arcSources, arcTargets, arcCapacities, arcCosts, nodeSupplies, numNodes, method));
+    return rcpp_result_gen;
+END_RCPP
+}
+// CostScalingGraphRunner
+Rcpp::List CostScalingGraphRunner(SEXP graph, std::vector<double> arcCapacities, std::vector<double> arcCosts, std::vector<double> nodeSupplies, std::string method);
+RcppExport SEXP _rlemon_CostScalingGraphRunner(SEXP graphSEXP, SEXP arcCapacitiesSEXP, SEXP arcCostsSEXP, SEXP nodeSuppliesSEXP, SEXP methodSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCapacities(arcCapacitiesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCosts(arcCostsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type nodeSupplies(nodeSuppliesSEXP);
+    Rcpp::traits::input_parameter< std::string >::type method(methodSEXP);
+    rcpp_result_gen = Rcpp::wrap(CostScalingGraphRunner(graph, arcCapacities, arcCosts, nodeSupplies, method));
     return rcpp_result_gen;
 END_RCPP
 }
 // NetworkSimplexRunner
-Rcpp::List NetworkSimplexRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcCapacities, std::vector<int> arcCosts, std::vector<int> nodeSupplies, int numNodes);
-RcppExport SEXP _rlemon_NetworkSimplexRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcCapacitiesSEXP, SEXP arcCostsSEXP, SEXP nodeSuppliesSEXP, SEXP numNodesSEXP) {
+Rcpp::List NetworkSimplexRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcCapacities, std::vector<double> arcCosts, std::vector<double> nodeSupplies, int numNodes, std::string method);
+RcppExport SEXP _rlemon_NetworkSimplexRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcCapacitiesSEXP, SEXP arcCostsSEXP, SEXP nodeSuppliesSEXP, SEXP numNodesSEXP, SEXP methodSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcCapacities(arcCapacitiesSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcCosts(arcCostsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type nodeSupplies(nodeSuppliesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCapacities(arcCapacitiesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCosts(arcCostsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type nodeSupplies(nodeSuppliesSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
-    rcpp_result_gen = Rcpp::wrap(NetworkSimplexRunner(arcSources, arcTargets, arcCapacities, arcCosts, nodeSupplies, numNodes));
+    Rcpp::traits::input_parameter< std::string >::type method(methodSEXP);
+    rcpp_result_gen = Rcpp::wrap(NetworkSimplexRunner(arcSources, arcTargets, arcCapacities, arcCosts, nodeSupplies, numNodes, method));
     return rcpp_result_gen;
 END_RCPP
 }
-// NagamochiIbarakiRunner
-Rcpp::List NagamochiIbarakiRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcWeights, int numNodes);
-RcppExport SEXP _rlemon_NagamochiIbarakiRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcWeightsSEXP, SEXP numNodesSEXP) {
+// NetworkSimplexGraphRunner
+Rcpp::List NetworkSimplexGraphRunner(SEXP graph, std::vector<double> arcCapacities, std::vector<double> arcCosts, std::vector<double> nodeSupplies, std::string method);
+RcppExport SEXP _rlemon_NetworkSimplexGraphRunner(SEXP graphSEXP, SEXP arcCapacitiesSEXP, SEXP arcCostsSEXP, SEXP nodeSuppliesSEXP, SEXP methodSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCapacities(arcCapacitiesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCosts(arcCostsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type nodeSupplies(nodeSuppliesSEXP);
+    Rcpp::traits::input_parameter< std::string >::type method(methodSEXP);
+    rcpp_result_gen = Rcpp::wrap(NetworkSimplexGraphRunner(graph, arcCapacities, arcCosts, nodeSupplies, method));
+    return rcpp_result_gen;
+END_RCPP
+}
+// NetworkSimplexSolverRunner
+SEXP NetworkSimplexSolverRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcCapacities, std::vector<double> arcCosts, std::vector<double> nodeSupplies, int numNodes);
+RcppExport SEXP _rlemon_NetworkSimplexSolverRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcCapacitiesSEXP, SEXP arcCostsSEXP, SEXP nodeSuppliesSEXP, SEXP numNodesSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcWeights(arcWeightsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCapacities(arcCapacitiesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCosts(arcCostsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type nodeSupplies(nodeSuppliesSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
-    rcpp_result_gen = Rcpp::wrap(NagamochiIbarakiRunner(arcSources, arcTargets, arcWeights, numNodes));
+    rcpp_result_gen = Rcpp::wrap(NetworkSimplexSolverRunner(arcSources, arcTargets, arcCapacities, arcCosts, nodeSupplies, numNodes));
+    return rcpp_result_gen;
+END_RCPP
+}
+// NetworkSimplexSolverUpdateRunner
+void NetworkSimplexSolverUpdateRunner(SEXP solver, std::vector<double> arcCapacities, std::vector<double> arcCosts, std::vector<double> nodeSupplies);
+RcppExport SEXP _rlemon_NetworkSimplexSolverUpdateRunner(SEXP solverSEXP, SEXP arcCapacitiesSEXP, SEXP arcCostsSEXP, SEXP nodeSuppliesSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type solver(solverSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCapacities(arcCapacitiesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcCosts(arcCostsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type nodeSupplies(nodeSuppliesSEXP);
+    NetworkSimplexSolverUpdateRunner(solver, arcCapacities, arcCosts, nodeSupplies);
+    return R_NilValue;
+END_RCPP
+}
+// NetworkSimplexSolverSolveRunner
+Rcpp::List NetworkSimplexSolverSolveRunner(SEXP solver);
+RcppExport SEXP _rlemon_NetworkSimplexSolverSolveRunner(SEXP solverSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type solver(solverSEXP);
+    rcpp_result_gen = Rcpp::wrap(NetworkSimplexSolverSolveRunner(solver));
+    return rcpp_result_gen;
+END_RCPP
+}
+// KargerSteinRunner
+Rcpp::List KargerSteinRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcWeights, int numNodes, int repetitions, int numThreads, int seed);
+RcppExport SEXP _rlemon_KargerSteinRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcWeightsSEXP, SEXP numNodesSEXP, SEXP repetitionsSEXP, SEXP numThreadsSEXP, SEXP seedSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcWeights(arcWeightsSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    Rcpp::traits::input_parameter< int >::type repetitions(repetitionsSEXP);
+    Rcpp::traits::input_parameter< int >::type numThreads(numThreadsSEXP);
+    Rcpp::traits::input_parameter< int >::type seed(seedSEXP);
+    rcpp_result_gen = Rcpp::wrap(KargerSteinRunner(arcSources, arcTargets, arcWeights, numNodes, repetitions, numThreads, seed));
     return rcpp_result_gen;
 END_RCPP
 }
 // HaoOrlinRunner
-Rcpp::List HaoOrlinRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcWeights, int numNodes);
+Rcpp::List HaoOrlinRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcWeights, int numNodes);
 RcppExport SEXP _rlemon_HaoOrlinRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcWeightsSEXP, SEXP numNodesSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcWeights(arcWeightsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcWeights(arcWeightsSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
     rcpp_result_gen = Rcpp::wrap(HaoOrlinRunner(arcSources, arcTargets, arcWeights, numNodes));
     return rcpp_result_gen;
 END_RCPP
 }
+// NagamochiIbarakiRunner
+Rcpp::List NagamochiIbarakiRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcWeights, int numNodes);
+RcppExport SEXP _rlemon_NagamochiIbarakiRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcWeightsSEXP, SEXP numNodesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcWeights(arcWeightsSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    rcpp_result_gen = Rcpp::wrap(NagamochiIbarakiRunner(arcSources, arcTargets, arcWeights, numNodes));
+    return rcpp_result_gen;
+END_RCPP
+}
 // GomoryHuTreeRunner
-Rcpp::List GomoryHuTreeRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcWeights, int numNodes);
-RcppExport SEXP _rlemon_GomoryHuTreeRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcWeightsSEXP, SEXP numNodesSEXP) {
+Rcpp::List GomoryHuTreeRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcWeights, int numNodes, int numThreads);
+RcppExport SEXP _rlemon_GomoryHuTreeRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcWeightsSEXP, SEXP numNodesSEXP, SEXP numThreadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcWeights(arcWeightsSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    Rcpp::traits::input_parameter< int >::type numThreads(numThreadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(GomoryHuTreeRunner(arcSources, arcTargets, arcWeights, numNodes, numThreads));
+    return rcpp_result_gen;
+END_RCPP
+}
+// GomoryHuIndexRunner
+SEXP GomoryHuIndexRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcWeights, int numNodes, int numThreads);
+RcppExport SEXP _rlemon_GomoryHuIndexRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcWeightsSEXP, SEXP numNodesSEXP, SEXP numThreadsSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcWeights(arcWeightsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcWeights(arcWeightsSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
-    rcpp_result_gen = Rcpp::wrap(GomoryHuTreeRunner(arcSources, arcTargets, arcWeights, numNodes));
+    Rcpp::traits::input_parameter< int >::type numThreads(numThreadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(GomoryHuIndexRunner(arcSources, arcTargets, arcWeights, numNodes, numThreads));
+    return rcpp_result_gen;
+END_RCPP
+}
+// GomoryHuQueryRunner
+Rcpp::List GomoryHuQueryRunner(SEXP index, std::vector<int> sourceNodes, std::vector<int> destinationNodes, bool cuts);
+RcppExport SEXP _rlemon_GomoryHuQueryRunner(SEXP indexSEXP, SEXP sourceNodesSEXP, SEXP destinationNodesSEXP, SEXP cutsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type index(indexSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type sourceNodes(sourceNodesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type destinationNodes(destinationNodesSEXP);
+    Rcpp::traits::input_parameter< bool >::type cuts(cutsSEXP);
+    rcpp_result_gen = Rcpp::wrap(GomoryHuQueryRunner(index, sourceNodes, destinationNodes, cuts));
     return rcpp_result_gen;
 END_RCPP
 }
 // HowardMmcRunner
-Rcpp::List HowardMmcRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcDistances, int numNodes);
+Rcpp::List HowardMmcRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int numNodes);
 RcppExport SEXP _rlemon_HowardMmcRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP numNodesSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
     rcpp_result_gen = Rcpp::wrap(HowardMmcRunner(arcSources, arcTargets, arcDistances, numNodes));
     return rcpp_result_gen;
 END_RCPP
 }
+// HowardMmcGraphRunner
+Rcpp::List HowardMmcGraphRunner(SEXP graph, std::vector<double> arcDistances);
+RcppExport SEXP _rlemon_HowardMmcGraphRunner(SEXP graphSEXP, SEXP arcDistancesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    rcpp_result_gen = Rcpp::wrap(HowardMmcGraphRunner(graph, arcDistances));
+    return rcpp_result_gen;
+END_RCPP
+}
 // KarpMmcRunner
-Rcpp::List KarpMmcRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcDistances, int numNodes);
+Rcpp::List KarpMmcRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int numNodes);
 RcppExport SEXP _rlemon_KarpMmcRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP numNodesSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
     rcpp_result_gen = Rcpp::wrap(KarpMmcRunner(arcSources, arcTargets, arcDistances, numNodes));
     return rcpp_result_gen;
 END_RCPP
 }
+// KarpMmcGraphRunner
+Rcpp::List KarpMmcGraphRunner(SEXP graph, std::vector<double> arcDistances);
+RcppExport SEXP _rlemon_KarpMmcGraphRunner(SEXP graphSEXP, SEXP arcDistancesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    rcpp_result_gen = Rcpp::wrap(KarpMmcGraphRunner(graph, arcDistances));
+    return rcpp_result_gen;
+END_RCPP
+}
 // HartmannOrlinMmcRunner
-Rcpp::List HartmannOrlinMmcRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcDistances, int numNodes);
+Rcpp::List HartmannOrlinMmcRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int numNodes);
 RcppExport SEXP _rlemon_HartmannOrlinMmcRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP numNodesSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
     rcpp_result_gen = Rcpp::wrap(HartmannOrlinMmcRunner(arcSources, arcTargets, arcDistances, numNodes));
     return rcpp_result_gen;
 END_RCPP
 }
+// HartmannOrlinMmcGraphRunner
+Rcpp::List HartmannOrlinMmcGraphRunner(SEXP graph, std::vector<double> arcDistances);
+RcppExport SEXP _rlemon_HartmannOrlinMmcGraphRunner(SEXP graphSEXP, SEXP arcDistancesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    rcpp_result_gen = Rcpp::wrap(HartmannOrlinMmcGraphRunner(graph, arcDistances));
+    return rcpp_result_gen;
+END_RCPP
+}
 // KruskalRunner
-Rcpp::List KruskalRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcDistances, int numNodes);
+Rcpp::List KruskalRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int numNodes);
 RcppExport SEXP _rlemon_KruskalRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP numNodesSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
     rcpp_result_gen = Rcpp::wrap(KruskalRunner(arcSources, arcTargets, arcDistances, numNodes));
     return rcpp_result_gen;
 END_RCPP
 }
 // MinCostArborescenceRunner
-Rcpp::List MinCostArborescenceRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcDistances, int sourceNode, int numNodes);
+Rcpp::List MinCostArborescenceRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int sourceNode, int numNodes);
 RcppExport SEXP _rlemon_MinCostArborescenceRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP sourceNodeSEXP, SEXP numNodesSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
     Rcpp::traits::input_parameter< int >::type sourceNode(sourceNodeSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
     rcpp_result_gen = Rcpp::wrap(MinCostArborescenceRunner(arcSources, arcTargets, arcDistances, sourceNode, numNodes));
     return rcpp_result_gen;
 END_RCPP
 }
+// MinCostArborescenceGraphRunner
+Rcpp::List MinCostArborescenceGraphRunner(SEXP graph, std::vector<double> arcDistances, int sourceNode);
+RcppExport SEXP _rlemon_MinCostArborescenceGraphRunner(SEXP graphSEXP, SEXP arcDistancesSEXP, SEXP sourceNodeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type sourceNode(sourceNodeSEXP);
+    rcpp_result_gen = Rcpp::wrap(MinCostArborescenceGraphRunner(graph, arcDistances, sourceNode));
+    return rcpp_result_gen;
+END_RCPP
+}
 // PlanarCheckingRunner
 bool PlanarCheckingRunner(std::vector<int> arcSources, std::vector<int> arcTargets, int numNodes);
 RcppExport SEXP _rlemon_PlanarCheckingRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP numNodesSEXP) {
@@ -780,14 +1373,14 @@ BEGIN_RCPP
 END_RCPP
 }
 // SuurballeRunner
-Rcpp::List SuurballeRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcDistances, int numNodes, int startNode, int endNode);
+Rcpp::List SuurballeRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int numNodes, int startNode, int endNode);
 RcppExport SEXP _rlemon_SuurballeRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP numNodesSEXP, SEXP startNodeSEXP, SEXP endNodeSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
     Rcpp::traits::input_parameter< int >::type startNode(startNodeSEXP);
     Rcpp::traits::input_parameter< int >::type endNode(endNodeSEXP);
@@ -795,107 +1388,335 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// SuurballeGraphRunner
+Rcpp::List SuurballeGraphRunner(SEXP graph, std::vector<double> arcDistances, int startNode, int endNode);
+RcppExport SEXP _rlemon_SuurballeGraphRunner(SEXP graphSEXP, SEXP arcDistancesSEXP, SEXP startNodeSEXP, SEXP endNodeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type startNode(startNodeSEXP);
+    Rcpp::traits::input_parameter< int >::type endNode(endNodeSEXP);
+    rcpp_result_gen = Rcpp::wrap(SuurballeGraphRunner(graph, arcDistances, startNode, endNode));
+    return rcpp_result_gen;
+END_RCPP
+}
 // DijkstraRunner
-Rcpp::List DijkstraRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcDistances, int numNodes, int startNode);
-RcppExport SEXP _rlemon_DijkstraRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP numNodesSEXP, SEXP startNodeSEXP) {
+Rcpp::List DijkstraRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int numNodes, int startNode, std::string heap);
+RcppExport SEXP _rlemon_DijkstraRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP numNodesSEXP, SEXP startNodeSEXP, SEXP heapSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
     Rcpp::traits::input_parameter< int >::type startNode(startNodeSEXP);
-    rcpp_result_gen = Rcpp::wrap(DijkstraRunner(arcSources, arcTargets, arcDistances, numNodes, startNode));
+    Rcpp::traits::input_parameter< std::string >::type heap(heapSEXP);
+    rcpp_result_gen = Rcpp::wrap(DijkstraRunner(arcSources, arcTargets, arcDistances, numNodes, startNode, heap));
+    return rcpp_result_gen;
+END_RCPP
+}
+// DijkstraGraphRunner
+Rcpp::List DijkstraGraphRunner(SEXP graph, std::vector<double> arcDistances, int startNode, std::string heap);
+RcppExport SEXP _rlemon_DijkstraGraphRunner(SEXP graphSEXP, SEXP arcDistancesSEXP, SEXP startNodeSEXP, SEXP heapSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type startNode(startNodeSEXP);
+    Rcpp::traits::input_parameter< std::string >::type heap(heapSEXP);
+    rcpp_result_gen = Rcpp::wrap(DijkstraGraphRunner(graph, arcDistances, startNode, heap));
+    return rcpp_result_gen;
+END_RCPP
+}
+// DijkstraBatchRunner
+Rcpp::List DijkstraBatchRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int numNodes, std::vector<int> startNodes, bool predecessors, int numThreads, std::string heap);
+RcppExport SEXP _rlemon_DijkstraBatchRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP numNodesSEXP, SEXP startNodesSEXP, SEXP predecessorsSEXP, SEXP numThreadsSEXP, SEXP heapSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type startNodes(startNodesSEXP);
+    Rcpp::traits::input_parameter< bool >::type predecessors(predecessorsSEXP);
+    Rcpp::traits::input_parameter< int >::type numThreads(numThreadsSEXP);
+    Rcpp::traits::input_parameter< std::string >::type heap(heapSEXP);
+    rcpp_result_gen = Rcpp::wrap(DijkstraBatchRunner(arcSources, arcTargets, arcDistances, numNodes, startNodes, predecessors, numThreads, heap));
+    return rcpp_result_gen;
+END_RCPP
+}
+// DijkstraBatchGraphRunner
+Rcpp::List DijkstraBatchGraphRunner(SEXP graph, std::vector<double> arcDistances, std::vector<int> startNodes, bool predecessors, int numThreads, std::string heap);
+RcppExport SEXP _rlemon_DijkstraBatchGraphRunner(SEXP graphSEXP, SEXP arcDistancesSEXP, SEXP startNodesSEXP, SEXP predecessorsSEXP, SEXP numThreadsSEXP, SEXP heapSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type startNodes(startNodesSEXP);
+    Rcpp::traits::input_parameter< bool >::type predecessors(predecessorsSEXP);
+    Rcpp::traits::input_parameter< int >::type numThreads(numThreadsSEXP);
+    Rcpp::traits::input_parameter< std::string >::type heap(heapSEXP);
+    rcpp_result_gen = Rcpp::wrap(DijkstraBatchGraphRunner(graph, arcDistances, startNodes, predecessors, numThreads, heap));
+    return rcpp_result_gen;
+END_RCPP
+}
+// DijkstraPathRunner
+Rcpp::List DijkstraPathRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int numNodes, int startNode, int endNode);
+RcppExport SEXP _rlemon_DijkstraPathRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP numNodesSEXP, SEXP startNodeSEXP, SEXP endNodeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    Rcpp::traits::input_parameter< int >::type startNode(startNodeSEXP);
+    Rcpp::traits::input_parameter< int >::type endNode(endNodeSEXP);
+    rcpp_result_gen = Rcpp::wrap(DijkstraPathRunner(arcSources, arcTargets, arcDistances, numNodes, startNode, endNode));
+    return rcpp_result_gen;
+END_RCPP
+}
+// DijkstraPathGraphRunner
+Rcpp::List DijkstraPathGraphRunner(SEXP graph, std::vector<double> arcDistances, int startNode, int endNode);
+RcppExport SEXP _rlemon_DijkstraPathGraphRunner(SEXP graphSEXP, SEXP arcDistancesSEXP, SEXP startNodeSEXP, SEXP endNodeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type startNode(startNodeSEXP);
+    Rcpp::traits::input_parameter< int >::type endNode(endNodeSEXP);
+    rcpp_result_gen = Rcpp::wrap(DijkstraPathGraphRunner(graph, arcDistances, startNode, endNode));
+    return rcpp_result_gen;
+END_RCPP
+}
+// BidirectionalDijkstraRunner
+Rcpp::List BidirectionalDijkstraRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int numNodes, int startNode, int endNode);
+RcppExport SEXP _rlemon_BidirectionalDijkstraRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP numNodesSEXP, SEXP startNodeSEXP, SEXP endNodeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    Rcpp::traits::input_parameter< int >::type startNode(startNodeSEXP);
+    Rcpp::traits::input_parameter< int >::type endNode(endNodeSEXP);
+    rcpp_result_gen = Rcpp::wrap(BidirectionalDijkstraRunner(arcSources, arcTargets, arcDistances, numNodes, startNode, endNode));
+    return rcpp_result_gen;
+END_RCPP
+}
+// BidirectionalDijkstraGraphRunner
+Rcpp::List BidirectionalDijkstraGraphRunner(SEXP graph, std::vector<double> arcDistances, int startNode, int endNode);
+RcppExport SEXP _rlemon_BidirectionalDijkstraGraphRunner(SEXP graphSEXP, SEXP arcDistancesSEXP, SEXP startNodeSEXP, SEXP endNodeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type startNode(startNodeSEXP);
+    Rcpp::traits::input_parameter< int >::type endNode(endNodeSEXP);
+    rcpp_result_gen = Rcpp::wrap(BidirectionalDijkstraGraphRunner(graph, arcDistances, startNode, endNode));
+    return rcpp_result_gen;
+END_RCPP
+}
+// AStarRunner
+Rcpp::List AStarRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int numNodes, int startNode, int endNode, std::vector<double> nodeX, std::vector<double> nodeY, std::string heuristic);
+RcppExport SEXP _rlemon_AStarRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP numNodesSEXP, SEXP startNodeSEXP, SEXP endNodeSEXP, SEXP nodeXSEXP, SEXP nodeYSEXP, SEXP heuristicSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    Rcpp::traits::input_parameter< int >::type startNode(startNodeSEXP);
+    Rcpp::traits::input_parameter< int >::type endNode(endNodeSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type nodeX(nodeXSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type nodeY(nodeYSEXP);
+    Rcpp::traits::input_parameter< std::string >::type heuristic(heuristicSEXP);
+    rcpp_result_gen = Rcpp::wrap(AStarRunner(arcSources, arcTargets, arcDistances, numNodes, startNode, endNode, nodeX, nodeY, heuristic));
+    return rcpp_result_gen;
+END_RCPP
+}
+// AStarGraphRunner
+Rcpp::List AStarGraphRunner(SEXP graph, std::vector<double> arcDistances, int startNode, int endNode, std::vector<double> nodeX, std::vector<double> nodeY, std::string heuristic);
+RcppExport SEXP _rlemon_AStarGraphRunner(SEXP graphSEXP, SEXP arcDistancesSEXP, SEXP startNodeSEXP, SEXP endNodeSEXP, SEXP nodeXSEXP, SEXP nodeYSEXP, SEXP heuristicSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type startNode(startNodeSEXP);
+    Rcpp::traits::input_parameter< int >::type endNode(endNodeSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type nodeX(nodeXSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type nodeY(nodeYSEXP);
+    Rcpp::traits::input_parameter< std::string >::type heuristic(heuristicSEXP);
+    rcpp_result_gen = Rcpp::wrap(AStarGraphRunner(graph, arcDistances, startNode, endNode, nodeX, nodeY, heuristic));
     return rcpp_result_gen;
 END_RCPP
 }
 // BellmanFordRunner
-Rcpp::List BellmanFordRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcDistances, int numNodes, int startNode);
+Rcpp::List BellmanFordRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int numNodes, int startNode);
 RcppExport SEXP _rlemon_BellmanFordRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP numNodesSEXP, SEXP startNodeSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
     Rcpp::traits::input_parameter< int >::type startNode(startNodeSEXP);
     rcpp_result_gen = Rcpp::wrap(BellmanFordRunner(arcSources, arcTargets, arcDistances, numNodes, startNode));
     return rcpp_result_gen;
 END_RCPP
 }
+// BellmanFordGraphRunner
+Rcpp::List BellmanFordGraphRunner(SEXP graph, std::vector<double> arcDistances, int startNode);
+RcppExport SEXP _rlemon_BellmanFordGraphRunner(SEXP graphSEXP, SEXP arcDistancesSEXP, SEXP startNodeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type startNode(startNodeSEXP);
+    rcpp_result_gen = Rcpp::wrap(BellmanFordGraphRunner(graph, arcDistances, startNode));
+    return rcpp_result_gen;
+END_RCPP
+}
+// JohnsonRunner
+Rcpp::NumericMatrix JohnsonRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int numNodes, int numThreads);
+RcppExport SEXP _rlemon_JohnsonRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP numNodesSEXP, SEXP numThreadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    Rcpp::traits::input_parameter< int >::type numThreads(numThreadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(JohnsonRunner(arcSources, arcTargets, arcDistances, numNodes, numThreads));
+    return rcpp_result_gen;
+END_RCPP
+}
+// JohnsonGraphRunner
+Rcpp::NumericMatrix JohnsonGraphRunner(SEXP graph, std::vector<double> arcDistances, int numThreads);
+RcppExport SEXP _rlemon_JohnsonGraphRunner(SEXP graphSEXP, SEXP arcDistancesSEXP, SEXP numThreadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type numThreads(numThreadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(JohnsonGraphRunner(graph, arcDistances, numThreads));
+    return rcpp_result_gen;
+END_RCPP
+}
+// FloydWarshallRunner
+Rcpp::NumericMatrix FloydWarshallRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int numNodes, int numThreads);
+RcppExport SEXP _rlemon_FloydWarshallRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP numNodesSEXP, SEXP numThreadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
+    Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
+    Rcpp::traits::input_parameter< int >::type numThreads(numThreadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(FloydWarshallRunner(arcSources, arcTargets, arcDistances, numNodes, numThreads));
+    return rcpp_result_gen;
+END_RCPP
+}
+// FloydWarshallGraphRunner
+Rcpp::NumericMatrix FloydWarshallGraphRunner(SEXP graph, std::vector<double> arcDistances, int numThreads);
+RcppExport SEXP _rlemon_FloydWarshallGraphRunner(SEXP graphSEXP, SEXP arcDistancesSEXP, SEXP numThreadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type graph(graphSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< int >::type numThreads(numThreadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(FloydWarshallGraphRunner(graph, arcDistances, numThreads));
+    return rcpp_result_gen;
+END_RCPP
+}
 // ChristofidesRunner
-Rcpp::List ChristofidesRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcDistances, int numNodes, int defaultEdgeWeight);
+Rcpp::List ChristofidesRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int numNodes, double defaultEdgeWeight);
 RcppExport SEXP _rlemon_ChristofidesRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP numNodesSEXP, SEXP defaultEdgeWeightSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
-    Rcpp::traits::input_parameter< int >::type defaultEdgeWeight(defaultEdgeWeightSEXP);
+    Rcpp::traits::input_parameter< double >::type defaultEdgeWeight(defaultEdgeWeightSEXP);
     rcpp_result_gen = Rcpp::wrap(ChristofidesRunner(arcSources, arcTargets, arcDistances, numNodes, defaultEdgeWeight));
     return rcpp_result_gen;
 END_RCPP
 }
 // GreedyTSPRunner
-Rcpp::List GreedyTSPRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcDistances, int numNodes, int defaultEdgeWeight);
+Rcpp::List GreedyTSPRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int numNodes, double defaultEdgeWeight);
 RcppExport SEXP _rlemon_GreedyTSPRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP numNodesSEXP, SEXP defaultEdgeWeightSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
-    Rcpp::traits::input_parameter< int >::type defaultEdgeWeight(defaultEdgeWeightSEXP);
+    Rcpp::traits::input_parameter< double >::type defaultEdgeWeight(defaultEdgeWeightSEXP);
     rcpp_result_gen = Rcpp::wrap(GreedyTSPRunner(arcSources, arcTargets, arcDistances, numNodes, defaultEdgeWeight));
     return rcpp_result_gen;
 END_RCPP
 }
 // InsertionTSPRunner
-Rcpp::List InsertionTSPRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcDistances, int numNodes, int defaultEdgeWeight);
+Rcpp::List InsertionTSPRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int numNodes, double defaultEdgeWeight);
 RcppExport SEXP _rlemon_InsertionTSPRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP numNodesSEXP, SEXP defaultEdgeWeightSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
-    Rcpp::traits::input_parameter< int >::type defaultEdgeWeight(defaultEdgeWeightSEXP);
+    Rcpp::traits::input_parameter< double >::type defaultEdgeWeight(defaultEdgeWeightSEXP);
     rcpp_result_gen = Rcpp::wrap(InsertionTSPRunner(arcSources, arcTargets, arcDistances, numNodes, defaultEdgeWeight));
     return rcpp_result_gen;
 END_RCPP
 }
 // NearestNeighborTSPRunner
-Rcpp::List NearestNeighborTSPRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcDistances, int numNodes, int defaultEdgeWeight);
+Rcpp::List NearestNeighborTSPRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int numNodes, double defaultEdgeWeight);
 RcppExport SEXP _rlemon_NearestNeighborTSPRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP numNodesSEXP, SEXP defaultEdgeWeightSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
-    Rcpp::traits::input_parameter< int >::type defaultEdgeWeight(defaultEdgeWeightSEXP);
+    Rcpp::traits::input_parameter< double >::type defaultEdgeWeight(defaultEdgeWeightSEXP);
     rcpp_result_gen = Rcpp::wrap(NearestNeighborTSPRunner(arcSources, arcTargets, arcDistances, numNodes, defaultEdgeWeight));
     return rcpp_result_gen;
 END_RCPP
 }
 // Opt2TSPRunner
-Rcpp::List Opt2TSPRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<int> arcDistances, int numNodes, int defaultEdgeWeight);
+Rcpp::List Opt2TSPRunner(std::vector<int> arcSources, std::vector<int> arcTargets, std::vector<double> arcDistances, int numNodes, double defaultEdgeWeight);
 RcppExport SEXP _rlemon_Opt2TSPRunner(SEXP arcSourcesSEXP, SEXP arcTargetsSEXP, SEXP arcDistancesSEXP, SEXP numNodesSEXP, SEXP defaultEdgeWeightSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< std::vector<int> >::type arcSources(arcSourcesSEXP);
     Rcpp::traits::input_parameter< std::vector<int> >::type arcTargets(arcTargetsSEXP);
-    Rcpp::traits::input_parameter< std::vector<int> >::type arcDistances(arcDistancesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type arcDistances(arcDistancesSEXP);
     Rcpp::traits::input_parameter< int >::type numNodes(numNodesSEXP);
-    Rcpp::traits::input_parameter< int >::type defaultEdgeWeight(defaultEdgeWeightSEXP);
+    Rcpp::traits::input_parameter< double >::type defaultEdgeWeight(defaultEdgeWeightSEXP);
     rcpp_result_gen = Rcpp::wrap(Opt2TSPRunner(arcSources, arcTargets, arcDistances, numNodes, defaultEdgeWeight));
     return rcpp_result_gen;
 END_RCPP
@@ -918,49 +1739,106 @@ static const R_CallMethodDef CallEntries[] = {
     {"_rlemon_IsParallelFreeRunner", (DL_FUNC) &_rlemon_IsParallelFreeRunner, 3},
     {"_rlemon_IsSimpleGraphRunner", (DL_FUNC) &_rlemon_IsSimpleGraphRunner, 3},
     {"_rlemon_IsEulerianRunner", (DL_FUNC) &_rlemon_IsEulerianRunner, 3},
+    {"_rlemon_GraphProfileRunner", (DL_FUNC) &_rlemon_GraphProfileRunner, 3},
     {"_rlemon_CountBiEdgeConnectedComponentsRunner", (DL_FUNC) &_rlemon_CountBiEdgeConnectedComponentsRunner, 3},
     {"_rlemon_CountConnectedComponentsRunner", (DL_FUNC) &_rlemon_CountConnectedComponentsRunner, 3},
     {"_rlemon_CountBiNodeConnectedComponentsRunner", (DL_FUNC) &_rlemon_CountBiNodeConnectedComponentsRunner, 3},
     {"_rlemon_CountStronglyConnectedComponentsRunner", (DL_FUNC) &_rlemon_CountStronglyConnectedComponentsRunner, 3},
     {"_rlemon_FindStronglyConnectedComponentsRunner", (DL_FUNC) &_rlemon_FindStronglyConnectedComponentsRunner, 3},
+    {"_rlemon_PearceComponentsRunner", (DL_FUNC) &_rlemon_PearceComponentsRunner, 3},
+    {"_rlemon_ColoringComponentsRunner", (DL_FUNC) &_rlemon_ColoringComponentsRunner, 4},
+    {"_rlemon_PearceComponentCountRunner", (DL_FUNC) &_rlemon_PearceComponentCountRunner, 3},
+    {"_rlemon_ColoringComponentCountRunner", (DL_FUNC) &_rlemon_ColoringComponentCountRunner, 4},
     {"_rlemon_FindStronglyConnectedCutArcsRunner", (DL_FUNC) &_rlemon_FindStronglyConnectedCutArcsRunner, 3},
     {"_rlemon_FindBiEdgeConnectedCutEdgesRunner", (DL_FUNC) &_rlemon_FindBiEdgeConnectedCutEdgesRunner, 3},
     {"_rlemon_FindBiNodeConnectedComponentsRunner", (DL_FUNC) &_rlemon_FindBiNodeConnectedComponentsRunner, 3},
     {"_rlemon_FindBiNodeConnectedCutNodesRunner", (DL_FUNC) &_rlemon_FindBiNodeConnectedCutNodesRunner, 3},
     {"_rlemon_FindConnectedComponentsRunner", (DL_FUNC) &_rlemon_FindConnectedComponentsRunner, 3},
+    {"_rlemon_UnionFindComponentsRunner", (DL_FUNC) &_rlemon_UnionFindComponentsRunner, 4},
+    {"_rlemon_UnionFindComponentCountRunner", (DL_FUNC) &_rlemon_UnionFindComponentCountRunner, 4},
     {"_rlemon_FindBiEdgeConnectedComponentsRunner", (DL_FUNC) &_rlemon_FindBiEdgeConnectedComponentsRunner, 3},
+    {"_rlemon_ContractionHierarchyRunner", (DL_FUNC) &_rlemon_ContractionHierarchyRunner, 4},
+    {"_rlemon_ContractionHierarchyQueryRunner", (DL_FUNC) &_rlemon_ContractionHierarchyQueryRunner, 5},
+    {"_rlemon_ContractionHierarchyExportRunner", (DL_FUNC) &_rlemon_ContractionHierarchyExportRunner, 1},
+    {"_rlemon_ContractionHierarchyImportRunner", (DL_FUNC) &_rlemon_ContractionHierarchyImportRunner, 7},
     {"_rlemon_GraphCompatabilityConverter", (DL_FUNC) &_rlemon_GraphCompatabilityConverter, 3},
+    {"_rlemon_GraphHandleRunner", (DL_FUNC) &_rlemon_GraphHandleRunner, 3},
     {"_rlemon_BfsRunner", (DL_FUNC) &_rlemon_BfsRunner, 5},
+    {"_rlemon_BfsGraphRunner", (DL_FUNC) &_rlemon_BfsGraphRunner, 3},
     {"_rlemon_DfsRunner", (DL_FUNC) &_rlemon_DfsRunner, 5},
+    {"_rlemon_DfsGraphRunner", (DL_FUNC) &_rlemon_DfsGraphRunner, 3},
     {"_rlemon_MaxCardinalitySearchRunner", (DL_FUNC) &_rlemon_MaxCardinalitySearchRunner, 5},
     {"_rlemon_CirculationRunner", (DL_FUNC) &_rlemon_CirculationRunner, 6},
+    {"_rlemon_CirculationGraphRunner", (DL_FUNC) &_rlemon_CirculationGraphRunner, 4},
     {"_rlemon_PreflowRunner", (DL_FUNC) &_rlemon_PreflowRunner, 6},
+    {"_rlemon_PreflowGraphRunner", (DL_FUNC) &_rlemon_PreflowGraphRunner, 4},
+    {"_rlemon_PreflowBatchRunner", (DL_FUNC) &_rlemon_PreflowBatchRunner, 8},
+    {"_rlemon_PreflowBatchGraphRunner", (DL_FUNC) &_rlemon_PreflowBatchGraphRunner, 6},
     {"_rlemon_EdmondsKarpRunner", (DL_FUNC) &_rlemon_EdmondsKarpRunner, 6},
+    {"_rlemon_EdmondsKarpGraphRunner", (DL_FUNC) &_rlemon_EdmondsKarpGraphRunner, 4},
+    {"_rlemon_ParallelPreflowRunner", (DL_FUNC) &_rlemon_ParallelPreflowRunner, 7},
+    {"_rlemon_ParallelPreflowGraphRunner", (DL_FUNC) &_rlemon_ParallelPreflowGraphRunner, 5},
+    {"_rlemon_BoykovKolmogorovRunner", (DL_FUNC) &_rlemon_BoykovKolmogorovRunner, 6},
+    {"_rlemon_BoykovKolmogorovGraphRunner", (DL_FUNC) &_rlemon_BoykovKolmogorovGraphRunner, 4},
+    {"_rlemon_GridBoykovKolmogorovRunner", (DL_FUNC) &_rlemon_GridBoykovKolmogorovRunner, 6},
+    {"_rlemon_PreflowSolverRunner", (DL_FUNC) &_rlemon_PreflowSolverRunner, 6},
+    {"_rlemon_PreflowSolverUpdateRunner", (DL_FUNC) &_rlemon_PreflowSolverUpdateRunner, 3},
+    {"_rlemon_PreflowSolverSolveRunner", (DL_FUNC) &_rlemon_PreflowSolverSolveRunner, 1},
     {"_rlemon_MaximumWeightPerfectMatchingRunner", (DL_FUNC) &_rlemon_MaximumWeightPerfectMatchingRunner, 4},
     {"_rlemon_MaximumWeightFractionalPerfectMatchingRunner", (DL_FUNC) &_rlemon_MaximumWeightFractionalPerfectMatchingRunner, 4},
     {"_rlemon_MaximumWeightFractionalMatchingRunner", (DL_FUNC) &_rlemon_MaximumWeightFractionalMatchingRunner, 4},
-    {"_rlemon_MaximumWeightMatchingRunner", (DL_FUNC) &_rlemon_MaximumWeightMatchingRunner, 4},
+    {"_rlemon_MaximumWeightMatchingRunner", (DL_FUNC) &_rlemon_MaximumWeightMatchingRunner, 5},
     {"_rlemon_MaximumCardinalityMatchingRunner", (DL_FUNC) &_rlemon_MaximumCardinalityMatchingRunner, 3},
     {"_rlemon_MaximumCardinalityFractionalMatchingRunner", (DL_FUNC) &_rlemon_MaximumCardinalityFractionalMatchingRunner, 3},
+    {"_rlemon_HungarianRunner", (DL_FUNC) &_rlemon_HungarianRunner, 2},
     {"_rlemon_CycleCancellingRunner", (DL_FUNC) &_rlemon_CycleCancellingRunner, 6},
+    {"_rlemon_CycleCancellingGraphRunner", (DL_FUNC) &_rlemon_CycleCancellingGraphRunner, 4},
     {"_rlemon_CapacityScalingRunner", (DL_FUNC) &_rlemon_CapacityScalingRunner, 6},
-    {"_rlemon_CostScalingRunner", (DL_FUNC) &_rlemon_CostScalingRunner, 6},
-    {"_rlemon_NetworkSimplexRunner", (DL_FUNC) &_rlemon_NetworkSimplexRunner, 6},
-    {"_rlemon_NagamochiIbarakiRunner", (DL_FUNC) &_rlemon_NagamochiIbarakiRunner, 4},
+    {"_rlemon_CapacityScalingGraphRunner", (DL_FUNC) &_rlemon_CapacityScalingGraphRunner, 4},
+    {"_rlemon_CostScalingRunner", (DL_FUNC) &_rlemon_CostScalingRunner, 7},
+    {"_rlemon_CostScalingGraphRunner", (DL_FUNC) &_rlemon_CostScalingGraphRunner, 5},
+    {"_rlemon_NetworkSimplexRunner", (DL_FUNC) &_rlemon_NetworkSimplexRunner, 7},
+    {"_rlemon_NetworkSimplexGraphRunner", (DL_FUNC) &_rlemon_NetworkSimplexGraphRunner, 5},
+    {"_rlemon_NetworkSimplexSolverRunner", (DL_FUNC) &_rlemon_NetworkSimplexSolverRunner, 6},
+    {"_rlemon_NetworkSimplexSolverUpdateRunner", (DL_FUNC) &_rlemon_NetworkSimplexSolverUpdateRunner, 4},
+    {"_rlemon_NetworkSimplexSolverSolveRunner", (DL_FUNC) &_rlemon_NetworkSimplexSolverSolveRunner, 1},
+    {"_rlemon_KargerSteinRunner", (DL_FUNC) &_rlemon_KargerSteinRunner, 7},
     {"_rlemon_HaoOrlinRunner", (DL_FUNC) &_rlemon_HaoOrlinRunner, 4},
-    {"_rlemon_GomoryHuTreeRunner", (DL_FUNC) &_rlemon_GomoryHuTreeRunner, 4},
+    {"_rlemon_NagamochiIbarakiRunner", (DL_FUNC) &_rlemon_NagamochiIbarakiRunner, 4},
+    {"_rlemon_GomoryHuTreeRunner", (DL_FUNC) &_rlemon_GomoryHuTreeRunner, 5},
+    {"_rlemon_GomoryHuIndexRunner", (DL_FUNC) &_rlemon_GomoryHuIndexRunner, 5},
+    {"_rlemon_GomoryHuQueryRunner", (DL_FUNC) &_rlemon_GomoryHuQueryRunner, 4},
     {"_rlemon_HowardMmcRunner", (DL_FUNC) &_rlemon_HowardMmcRunner, 4},
+    {"_rlemon_HowardMmcGraphRunner", (DL_FUNC) &_rlemon_HowardMmcGraphRunner, 2},
     {"_rlemon_KarpMmcRunner", (DL_FUNC) &_rlemon_KarpMmcRunner, 4},
+    {"_rlemon_KarpMmcGraphRunner", (DL_FUNC) &_rlemon_KarpMmcGraphRunner, 2},
     {"_rlemon_HartmannOrlinMmcRunner", (DL_FUNC) &_rlemon_HartmannOrlinMmcRunner, 4},
+    {"_rlemon_HartmannOrlinMmcGraphRunner", (DL_FUNC) &_rlemon_HartmannOrlinMmcGraphRunner, 2},
     {"_rlemon_KruskalRunner", (DL_FUNC) &_rlemon_KruskalRunner, 4},
     {"_rlemon_MinCostArborescenceRunner", (DL_FUNC) &_rlemon_MinCostArborescenceRunner, 5},
+    {"_rlemon_MinCostArborescenceGraphRunner", (DL_FUNC) &_rlemon_MinCostArborescenceGraphRunner, 3},
     {"_rlemon_PlanarCheckingRunner", (DL_FUNC) &_rlemon_PlanarCheckingRunner, 3},
     {"_rlemon_PlanarEmbeddingRunner", (DL_FUNC) &_rlemon_PlanarEmbeddingRunner, 3},
     {"_rlemon_PlanarColoringRunner", (DL_FUNC) &_rlemon_PlanarColoringRunner, 4},
     {"_rlemon_PlanarDrawingRunner", (DL_FUNC) &_rlemon_PlanarDrawingRunner, 3},
     {"_rlemon_SuurballeRunner", (DL_FUNC) &_rlemon_SuurballeRunner, 6},
-    {"_rlemon_DijkstraRunner", (DL_FUNC) &_rlemon_DijkstraRunner, 5},
+    {"_rlemon_SuurballeGraphRunner", (DL_FUNC) &_rlemon_SuurballeGraphRunner, 4},
+    {"_rlemon_DijkstraRunner", (DL_FUNC) &_rlemon_DijkstraRunner, 6},
+    {"_rlemon_DijkstraGraphRunner", (DL_FUNC) &_rlemon_DijkstraGraphRunner, 4},
+    {"_rlemon_DijkstraBatchRunner", (DL_FUNC) &_rlemon_DijkstraBatchRunner, 8},
+    {"_rlemon_DijkstraBatchGraphRunner", (DL_FUNC) &_rlemon_DijkstraBatchGraphRunner, 6},
+    {"_rlemon_DijkstraPathRunner", (DL_FUNC) &_rlemon_DijkstraPathRunner, 6},
+    {"_rlemon_DijkstraPathGraphRunner", (DL_FUNC) &_rlemon_DijkstraPathGraphRunner, 4},
+    {"_rlemon_BidirectionalDijkstraRunner", (DL_FUNC) &_rlemon_BidirectionalDijkstraRunner, 6},
+    {"_rlemon_BidirectionalDijkstraGraphRunner", (DL_FUNC) &_rlemon_BidirectionalDijkstraGraphRunner, 4},
+    {"_rlemon_AStarRunner", (DL_FUNC) &_rlemon_AStarRunner, 9},
+    {"_rlemon_AStarGraphRunner", (DL_FUNC) &_rlemon_AStarGraphRunner, 7},
     {"_rlemon_BellmanFordRunner", (DL_FUNC) &_rlemon_BellmanFordRunner, 5},
+    {"_rlemon_BellmanFordGraphRunner", (DL_FUNC) &_rlemon_BellmanFordGraphRunner, 3},
+    {"_rlemon_JohnsonRunner", (DL_FUNC) &_rlemon_JohnsonRunner, 5},
+    {"_rlemon_JohnsonGraphRunner", (DL_FUNC) &_rlemon_JohnsonGraphRunner, 3},
+    {"_rlemon_FloydWarshallRunner", (DL_FUNC) &_rlemon_FloydWarshallRunner, 5},
+    {"_rlemon_FloydWarshallGraphRunner", (DL_FUNC) &_rlemon_FloydWarshallGraphRunner, 3},
     {"_rlemon_ChristofidesRunner", (DL_FUNC) &_rlemon_ChristofidesRunner, 5},
     {"_rlemon_GreedyTSPRunner", (DL_FUNC) &_rlemon_GreedyTSPRunner, 5},
     {"_rlemon_InsertionTSPRunner", (DL_FUNC) &_rlemon_InsertionTSPRunner, 5},
@@ -1,4 +1,8 @@
-#include "lemon/list_graph.h"
+#include "graph_handle.h"
+#include "graph_profile.h"
+#include "lemon/adaptors.h"
+#include "parallel_components.h"
+#include "strong_components.h"
 #include <Rcpp.h>
 #include <iostream>
 #include <lemon/connectivity.h>
@@ -7,22 +11,20 @@
 #include <vector>
 using namespace lemon;
 
+// The undirected checks below view the directed graph built by
+// BuildDigraph() as an undirected one; each arc becomes an edge.
+typedef Undirector<const DigraphHandle::Digraph> UndirectedView;
+
 //' @rdname lemon_runners
 // [[Rcpp::export]]
 Rcpp::List getBipartitePartitionsRunner(std::vector<int> arcSources,
                                         std::vector<int> arcTargets,
                                         int numNodes) {
-  ListGraph g;
-  std::vector<ListGraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListGraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
-  ListGraph::NodeMap<int> nodePartition(g);
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  UndirectedView g(h.g);
+  const std::vector<DigraphHandle::Digraph::Node> &nodes = h.nodes;
+  UndirectedView::NodeMap<int> nodePartition(g);
   bool isBipartite = bipartitePartitions(g, nodePartition);
   std::vector<int> out_partitions;
   if (isBipartite) {
@@ -38,17 +40,11 @@ Rcpp::List getBipartitePartitionsRunner(std::vector<int> arcSources,
 Rcpp::List getAndCheckTopologicalSortRunner(std::vector<int> arcSources,
                                             std::vector<int> arcTargets,
                                             int numNodes) {
-  ListDigraph g;
-  std::vector<ListDigraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
-  ListDigraph::NodeMap<int> nodeOrder(g);
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  const DigraphHandle::Digraph &g = h.g;
+  const std::vector<DigraphHandle::Digraph::Node> &nodes = h.nodes;
+  DigraphHandle::Digraph::NodeMap<int> nodeOrder(g);
   bool isDAG = checkedTopologicalSort(g, nodeOrder);
   std::vector<int> order;
   if (isDAG) {
@@ -64,17 +60,11 @@ Rcpp::List getAndCheckTopologicalSortRunner(std::vector<int> arcSources,
 std::vector<int> getTopologicalSortRunner(std::vector<int> arcSources,
                                           std::vector<int> arcTargets,
                                           int numNodes) {
-  ListDigraph g;
-  std::vector<ListDigraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
-  ListDigraph::NodeMap<int> nodeOrder(g);
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  const DigraphHandle::Digraph &g = h.g;
+  const std::vector<DigraphHandle::Digraph::Node> &nodes = h.nodes;
+  DigraphHandle::Digraph::NodeMap<int> nodeOrder(g);
   topologicalSort(g, nodeOrder);
   std::vector<int> order;
   for (int i = 0; i < numNodes; ++i) {
@@ -87,16 +77,9 @@ std::vector<int> getTopologicalSortRunner(std::vector<int> arcSources,
 // [[Rcpp::export]]
 int IsConnectedRunner(std::vector<int> arcSources, std::vector<int> arcTargets,
                       int numNodes) {
-  ListGraph g;
-  std::vector<ListGraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListGraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  UndirectedView g(h.g);
   return connected(g);
 }
 
@@ -104,16 +87,9 @@ int IsConnectedRunner(std::vector<int> arcSources, std::vector<int> arcTargets,
 // [[Rcpp::export]]
 int IsAcyclicRunner(std::vector<int> arcSources, std::vector<int> arcTargets,
                     int numNodes) {
-  ListGraph g;
-  std::vector<ListGraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListGraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  UndirectedView g(h.g);
   return acyclic(g);
 }
 
@@ -121,16 +97,9 @@ int IsAcyclicRunner(std::vector<int> arcSources, std::vector<int> arcTargets,
 // [[Rcpp::export]]
 int IsTreeRunner(std::vector<int> arcSources, std::vector<int> arcTargets,
                  int numNodes) {
-  ListGraph g;
-  std::vector<ListGraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListGraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  UndirectedView g(h.g);
   return tree(g);
 }
 
@@ -138,16 +107,9 @@ int IsTreeRunner(std::vector<int> arcSources, std::vector<int> arcTargets,
 // [[Rcpp::export]]
 int IsBipartiteRunner(std::vector<int> arcSources, std::vector<int> arcTargets,
                       int numNodes) {
-  ListGraph g;
-  std::vector<ListGraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListGraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  UndirectedView g(h.g);
   return bipartite(g);
 }
 
@@ -155,16 +117,9 @@ int IsBipartiteRunner(std::vector<int> arcSources, std::vector<int> arcTargets,
 // [[Rcpp::export]]
 int IsStronglyConnectedRunner(std::vector<int> arcSources,
                               std::vector<int> arcTargets, int numNodes) {
-  ListDigraph g;
-  std::vector<ListDigraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  const DigraphHandle::Digraph &g = h.g;
   return stronglyConnected(g);
 }
 
@@ -172,16 +127,9 @@ int IsStronglyConnectedRunner(std::vector<int> arcSources,
 // [[Rcpp::export]]
 int IsDAGRunner(std::vector<int> arcSources, std::vector<int> arcTargets,
                 int numNodes) {
-  ListDigraph g;
-  std::vector<ListDigraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  const DigraphHandle::Digraph &g = h.g;
   return dag(g);
 }
 
@@ -189,16 +137,9 @@ int IsDAGRunner(std::vector<int> arcSources, std::vector<int> arcTargets,
 // [[Rcpp::export]]
 int IsBiNodeConnectedRunner(std::vector<int> arcSources,
                             std::vector<int> arcTargets, int numNodes) {
-  ListGraph g;
-  std::vector<ListGraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListGraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  UndirectedView g(h.g);
   return biNodeConnected(g);
 }
 
@@ -210,16 +151,9 @@ int IsBiEdgeConnectedRunner(std::vector<int> arcSources,
   //           One std::vector, arcDistances, which assigns for each arc an associated distance
   //           Two ints, numNodes and startnode, which give us the number of nodes in the directed graph and the starting node for Bellman Ford
   // Returns: A boolean stating if we have a bi-edge connected graph or not
-  ListGraph g;
-  std::vector<ListGraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListGraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  UndirectedView g(h.g);
   return biEdgeConnected(g);
 }
 
@@ -231,16 +165,9 @@ int IsLoopFreeRunner(std::vector<int> arcSources, std::vector<int> arcTargets,
   //           One std::vector, arcDistances, which assigns for each arc an associated distance
   //           Two ints, numNodes and startnode, which give us the number of nodes in the directed graph and the starting node for Bellman Ford
   // Returns: A boolean stating if the graph has no loop arcs/edges.
-  ListGraph g;
-  std::vector<ListGraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListGraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  UndirectedView g(h.g);
   return loopFree(g);
 }
 
@@ -252,16 +179,9 @@ int IsParallelFreeRunner(std::vector<int> arcSources,
   //           One std::vector, arcDistances, which assigns for each arc an associated distance
   //           Two ints, numNodes and startnode, which give us the number of nodes in the directed graph and the starting node for Bellman Ford
   // Returns: A boolean stating if the graph has no parallel arcs/edges.
-  ListGraph g;
-  std::vector<ListGraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListGraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  UndirectedView g(h.g);
   return parallelFree(g);
 }
 
@@ -273,16 +193,9 @@ int IsSimpleGraphRunner(std::vector<int> arcSources,
   //           One std::vector, arcDistances, which assigns for each arc an associated distance
   //           Two ints, numNodes and startnode, which give us the number of nodes in the directed graph and the starting node for Bellman Ford
   // Returns: A boolean stating if the graph is simple, i.e. it has no loop arcs/edges or parallel arcs/edges
-  ListGraph g;
-  std::vector<ListGraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListGraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  UndirectedView g(h.g);
   return simpleGraph(g);
 }
 
@@ -294,19 +207,32 @@ int IsEulerianRunner(std::vector<int> arcSources, std::vector<int> arcTargets,
   //           One std::vector, arcDistances, which assigns for each arc an associated distance
   //           Two ints, numNodes and startnode, which give us the number of nodes in the directed graph and the starting node for Bellman Ford
   // Returns: A boolean stating if the graph is simple, i.e. it has an Eulerian cycle
-  ListGraph g;
-  std::vector<ListGraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListGraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  UndirectedView g(h.g);
   return eulerian(g);
 }
 
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List GraphProfileRunner(std::vector<int> arcSources,
+                              std::vector<int> arcTargets, int numNodes) {
+  // Returns: The results of the Is*Runner functions above and of the
+  // Count*ComponentsRunner functions, found together
+  GraphProfile profile(numNodes, arcSources, arcTargets);
+  profile.run();
+  return Rcpp::List::create(
+      profile.isConnected(), profile.isAcyclic(), profile.isTree(),
+      profile.isBipartite(), profile.isStronglyConnected(), profile.isDAG(),
+      profile.isBiNodeConnected(), profile.isBiEdgeConnected(),
+      profile.isLoopFree(), profile.isParallelFree(),
+      profile.isSimpleGraph(), profile.isEulerian(),
+      profile.connectedComponentNum(),
+      profile.stronglyConnectedComponentNum(),
+      profile.biNodeConnectedComponentNum(),
+      profile.biEdgeConnectedComponentNum());
+}
+
 //' @rdname lemon_runners
 // [[Rcpp::export]]
 int CountBiEdgeConnectedComponentsRunner(std::vector<int> arcSources,
@@ -316,16 +242,9 @@ int CountBiEdgeConnectedComponentsRunner(std::vector<int> arcSources,
   //           One std::vector, arcDistances, which assigns for each arc an associated distance
   //           Two ints, numNodes and startnode, which give us the number of nodes in the directed graph and the starting node for Bellman Ford
   // Returns: A boolean stating if we have a bi-node connected graph or not
-  ListGraph g;
-  std::vector<ListGraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListGraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  UndirectedView g(h.g);
   return countBiEdgeConnectedComponents(g);
 }
 
@@ -337,16 +256,9 @@ int CountConnectedComponentsRunner(std::vector<int> arcSources,
   //           One std::vector, arcDistances, which assigns for each arc an associated distance
   //           Two ints, numNodes and startnode, which give us the number of nodes in the directed graph and the starting node for Bellman Ford
   // Returns: An integer stating the number of connected components of this graph
-  ListGraph g;
-  std::vector<ListGraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListGraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  UndirectedView g(h.g);
   return countConnectedComponents(g);
 }
 
@@ -359,16 +271,9 @@ int CountBiNodeConnectedComponentsRunner(std::vector<int> arcSources,
   //           One std::vector, arcDistances, which assigns for each arc an associated distance
   //           Two ints, numNodes and startnode, which give us the number of nodes in the directed graph and the starting node for Bellman Ford
   // Returns: An integer stating the number of bi-node connected components of this graph
-  ListGraph g;
-  std::vector<ListGraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListGraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  UndirectedView g(h.g);
   return countBiNodeConnectedComponents(g);
 }
 
@@ -377,16 +282,9 @@ int CountBiNodeConnectedComponentsRunner(std::vector<int> arcSources,
 int CountStronglyConnectedComponentsRunner(std::vector<int> arcSources,
                                            std::vector<int> arcTargets,
                                            int numNodes) {
-  ListDigraph g;
-  std::vector<ListDigraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  const DigraphHandle::Digraph &g = h.g;
   return countStronglyConnectedComponents(g);
 }
 
@@ -394,17 +292,11 @@ int CountStronglyConnectedComponentsRunner(std::vector<int> arcSources,
 // [[Rcpp::export]]
 std::vector<int> FindStronglyConnectedComponentsRunner(
     std::vector<int> arcSources, std::vector<int> arcTargets, int numNodes) {
-  ListDigraph g;
-  std::vector<ListDigraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
-  ListDigraph::NodeMap<int> ComponentMap(g);
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  const DigraphHandle::Digraph &g = h.g;
+  const std::vector<DigraphHandle::Digraph::Node> &nodes = h.nodes;
+  DigraphHandle::Digraph::NodeMap<int> ComponentMap(g);
   stronglyConnectedComponents(g, ComponentMap);
   std::vector<int> components;
   for (int i = 0; i < numNodes; i++) {
@@ -414,25 +306,75 @@ std::vector<int> FindStronglyConnectedComponentsRunner(
   return components;
 }
 
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+std::vector<int> PearceComponentsRunner(std::vector<int> arcSources,
+                                        std::vector<int> arcTargets,
+                                        int numNodes) {
+  // Returns: The same component numbers as
+  // FindStronglyConnectedComponentsRunner, found by an iterative search
+  IterativeStrongComponents components(numNodes, arcSources, arcTargets);
+  components.run();
+  std::vector<int> result(numNodes);
+  for (int i = 0; i < numNodes; ++i) {
+    result[i] = components.component(i + 1);
+  }
+  return result;
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+std::vector<int> ColoringComponentsRunner(std::vector<int> arcSources,
+                                          std::vector<int> arcTargets,
+                                          int numNodes, int numThreads) {
+  // Returns: The strongly connected component of each node, numbered in the
+  // order of their last node
+  ParallelStrongComponents components(numNodes, arcSources, arcTargets,
+                                      numThreads);
+  components.run();
+  std::vector<int> result(numNodes);
+  for (int i = 0; i < numNodes; ++i) {
+    result[i] = components.component(i + 1);
+  }
+  return result;
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+int PearceComponentCountRunner(std::vector<int> arcSources,
+                               std::vector<int> arcTargets, int numNodes) {
+  // Returns: The number of strongly connected components, found as by
+  // PearceComponentsRunner
+  IterativeStrongComponents components(numNodes, arcSources, arcTargets);
+  components.run();
+  return components.componentNum();
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+int ColoringComponentCountRunner(std::vector<int> arcSources,
+                                 std::vector<int> arcTargets, int numNodes,
+                                 int numThreads) {
+  // Returns: The number of strongly connected components, found as by
+  // ColoringComponentsRunner
+  ParallelStrongComponents components(numNodes, arcSources, arcTargets,
+                                      numThreads);
+  components.run();
+  return components.componentNum();
+}
+
 //' @rdname lemon_runners
 // [[Rcpp::export]]
 Rcpp::List FindStronglyConnectedCutArcsRunner(std::vector<int> arcSources,
                                               std::vector<int> arcTargets,
                                               int numNodes) {
   // Returns: Two std::vectors containing the source and destination of the cut arcs
-  ListDigraph g;
-  std::vector<ListDigraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  std::vector<ListDigraph::Arc> arcs;
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    auto a = g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    arcs.push_back(a);
-  }
-  ListDigraph::ArcMap<int> ComponentMap(g);
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  const DigraphHandle::Digraph &g = h.g;
+  const std::vector<DigraphHandle::Digraph::Arc> &arcs = h.arcs;
+  int NUM_ARCS = arcs.size();
+  DigraphHandle::Digraph::ArcMap<int> ComponentMap(g);
 
   stronglyConnectedCutArcs(g, ComponentMap);
   std::vector<int> arc_sources;
@@ -453,19 +395,12 @@ Rcpp::List FindBiEdgeConnectedCutEdgesRunner(std::vector<int> arcSources,
                                              std::vector<int> arcTargets,
                                              int numNodes) {
   // Returns: Two std::vectors containing the source and destination of the cut arcs
-  ListGraph g;
-  std::vector<ListGraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListGraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  std::vector<ListGraph::Edge> arcs;
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    auto a = g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    arcs.push_back(a);
-  }
-  ListGraph::EdgeMap<int> ComponentMap(g);
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  UndirectedView g(h.g);
+  const std::vector<DigraphHandle::Digraph::Arc> &arcs = h.arcs;
+  int NUM_ARCS = arcs.size();
+  UndirectedView::EdgeMap<int> ComponentMap(g);
 
   biEdgeConnectedCutEdges(g, ComponentMap);
   std::vector<int> arc_sources;
@@ -484,19 +419,12 @@ Rcpp::List FindBiEdgeConnectedCutEdgesRunner(std::vector<int> arcSources,
 std::vector<int>
 FindBiNodeConnectedComponentsRunner(std::vector<int> arcSources,
                                     std::vector<int> arcTargets, int numNodes) {
-  ListGraph g;
-  std::vector<ListGraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListGraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  std::vector<ListGraph::Edge> arcs;
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    auto a = g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    arcs.push_back(a);
-  }
-  ListGraph::EdgeMap<int> ComponentMap(g);
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  UndirectedView g(h.g);
+  const std::vector<DigraphHandle::Digraph::Arc> &arcs = h.arcs;
+  int NUM_ARCS = arcs.size();
+  UndirectedView::EdgeMap<int> ComponentMap(g);
   biNodeConnectedComponents(g, ComponentMap);
   std::vector<int> component_number;
   for (int i = 0; i < NUM_ARCS; i++) {
@@ -510,19 +438,11 @@ FindBiNodeConnectedComponentsRunner(std::vector<int> arcSources,
 std::vector<int> FindBiNodeConnectedCutNodesRunner(std::vector<int> arcSources,
                                                    std::vector<int> arcTargets,
                                                    int numNodes) {
-  ListGraph g;
-  std::vector<ListGraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListGraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  std::vector<ListGraph::Edge> arcs;
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    auto a = g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    arcs.push_back(a);
-  }
-  ListGraph::NodeMap<int> CutMap(g);
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  UndirectedView g(h.g);
+  const std::vector<DigraphHandle::Digraph::Node> &nodes = h.nodes;
+  UndirectedView::NodeMap<int> CutMap(g);
   biNodeConnectedCutNodes(g, CutMap);
   std::vector<int> CutNodes;
   for (int i = 0; i < numNodes; ++i) {
@@ -539,17 +459,11 @@ std::vector<int> FindConnectedComponentsRunner(std::vector<int> arcSources,
                                                std::vector<int> arcTargets,
                                                int numNodes) {
   // Returns: A std::vector containing the component number of each node
-  ListGraph g;
-  std::vector<ListGraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListGraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
-  ListGraph::NodeMap<int> ComponentMap(g);
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  UndirectedView g(h.g);
+  const std::vector<DigraphHandle::Digraph::Node> &nodes = h.nodes;
+  UndirectedView::NodeMap<int> ComponentMap(g);
   connectedComponents(g, ComponentMap);
   std::vector<int> components;
   for (int i = 0; i < numNodes; i++) {
@@ -559,22 +473,46 @@ std::vector<int> FindConnectedComponentsRunner(std::vector<int> arcSources,
   return components;
 }
 
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+std::vector<int> UnionFindComponentsRunner(std::vector<int> arcSources,
+                                           std::vector<int> arcTargets,
+                                           int numNodes, int numThreads) {
+  // Returns: The same component numbers as FindConnectedComponentsRunner,
+  // found with a concurrent union-find straight from the arcs
+  ParallelComponents components(numNodes, arcSources, arcTargets,
+                                numThreads);
+  components.run();
+  std::vector<int> result(numNodes);
+  for (int i = 0; i < numNodes; ++i) {
+    result[i] = components.component(i + 1);
+  }
+  return result;
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+int UnionFindComponentCountRunner(std::vector<int> arcSources,
+                                  std::vector<int> arcTargets, int numNodes,
+                                  int numThreads) {
+  // Returns: The number of connected components, found as by
+  // UnionFindComponentsRunner
+  ParallelComponents components(numNodes, arcSources, arcTargets,
+                                numThreads);
+  components.run();
+  return components.componentNum();
+}
+
 //' @rdname lemon_runners
 // [[Rcpp::export]]
 std::vector<int>
 FindBiEdgeConnectedComponentsRunner(std::vector<int> arcSources,
                                     std::vector<int> arcTargets, int numNodes) {
-  ListGraph g;
-  std::vector<ListGraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListGraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  int NUM_ARCS = arcSources.size();
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-  }
-  ListGraph::NodeMap<int> ComponentMap(g);
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  UndirectedView g(h.g);
+  const std::vector<DigraphHandle::Digraph::Node> &nodes = h.nodes;
+  UndirectedView::NodeMap<int> ComponentMap(g);
   biEdgeConnectedComponents(g, ComponentMap);
   std::vector<int> components;
   for (int i = 0; i < numNodes; i++) {
@@ -0,0 +1,603 @@
+#include "parallel.h"
+
+#include <Rcpp.h>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+// A contraction hierarchy: an index for repeated shortest path queries on a
+// fixed directed graph with non-negative arc lengths.
+//
+// Nodes are contracted one at a time, lowest rank first. Contracting v adds
+// a shortcut u -> w for each pair of remaining neighbours whose shortest
+// path runs through v, so that v can be ignored from then on. A query then
+// only needs to search "upwards" (towards higher ranks) from both ends,
+// which touches a tiny part of the graph.
+//
+// The arcs of the hierarchy (the input arcs that remain, and the shortcuts)
+// are kept in one list. Each shortcut records the two arcs it stands for,
+// which is how query paths are unpacked. The upward arcs, grouped by source,
+// and the downward arcs, grouped by target, are stored in compressed
+// (CSR) form, as in StaticDigraph.
+struct ContractionHierarchy {
+  int numNodes;
+  std::vector<int> rank;
+
+  std::vector<int> arcSource;
+  std::vector<int> arcTarget;
+  std::vector<double> arcWeight;
+  // For a shortcut u -> w made by contracting m, the arcs u -> m and
+  // m -> w; -1 for an input arc.
+  std::vector<int> arcFirst;
+  std::vector<int> arcSecond;
+
+  // Arcs to a higher ranked node, by source: upArcs[upFirst[v]] up to
+  // upArcs[upFirst[v + 1]] leave v.
+  std::vector<int> upFirst;
+  std::vector<int> upArcs;
+  // Arcs from a higher ranked node, by target.
+  std::vector<int> downFirst;
+  std::vector<int> downArcs;
+};
+
+// Fills the CSR arrays of `ch` from its ranks and arcs.
+inline void IndexHierarchy(ContractionHierarchy &ch) {
+  int n = ch.numNodes;
+  int NUM_ARCS = ch.arcSource.size();
+  ch.upFirst.assign(n + 1, 0);
+  ch.downFirst.assign(n + 1, 0);
+  for (int a = 0; a < NUM_ARCS; ++a) {
+    int u = ch.arcSource[a], w = ch.arcTarget[a];
+    if (ch.rank[u] < ch.rank[w]) {
+      ++ch.upFirst[u + 1];
+    } else {
+      ++ch.downFirst[w + 1];
+    }
+  }
+  for (int v = 0; v < n; ++v) {
+    ch.upFirst[v + 1] += ch.upFirst[v];
+    ch.downFirst[v + 1] += ch.downFirst[v];
+  }
+  ch.upArcs.resize(ch.upFirst[n]);
+  ch.downArcs.resize(ch.downFirst[n]);
+  std::vector<int> upNext(ch.upFirst.begin(), ch.upFirst.end() - 1);
+  std::vector<int> downNext(ch.downFirst.begin(), ch.downFirst.end() - 1);
+  for (int a = 0; a < NUM_ARCS; ++a) {
+    int u = ch.arcSource[a], w = ch.arcTarget[a];
+    if (ch.rank[u] < ch.rank[w]) {
+      ch.upArcs[upNext[u]++] = a;
+    } else {
+      ch.downArcs[downNext[w]++] = a;
+    }
+  }
+}
+
+// Contracts the graph given by the 1-indexed arcSources/arcTargets into
+// `ch`. Nodes are ordered by edge difference (shortcuts added minus arcs
+// removed), plus the number of neighbours already contracted and the depth
+// of the hierarchy below the node, which spread the contraction evenly over
+// the graph and keep query search spaces small. Updates are lazy: a node's
+// priority is recomputed when it reaches the top of the queue, and it is put
+// back if it is no longer the minimum. Witness searches are local Dijkstra
+// searches capped at WITNESS_SETTLE_LIMIT nodes (ESTIMATE_SETTLE_LIMIT when
+// only computing a priority); a search that gives up early only costs an
+// unnecessary shortcut, never a wrong answer.
+inline void BuildHierarchy(ContractionHierarchy &ch,
+                           const std::vector<int> &arcSources,
+                           const std::vector<int> &arcTargets,
+                           const std::vector<double> &arcDistances,
+                           int numNodes) {
+  const int WITNESS_SETTLE_LIMIT = 500;
+  const int ESTIMATE_SETTLE_LIMIT = 50;
+  const double INF = std::numeric_limits<double>::infinity();
+  struct Edge {
+    int node;
+    int arc;
+  };
+  typedef std::pair<double, int> Entry;
+  typedef std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry> >
+      MinQueue;
+
+  int n = numNodes;
+  std::vector<int> arcSource, arcTarget, arcFirst, arcSecond;
+  std::vector<double> arcWeight;
+  std::vector<std::vector<Edge> > out(n), in(n);
+
+  // Adds the arc u -> w, or shortens the existing one. Returns false if an
+  // arc at least as short is already there.
+  auto addArc = [&](int u, int w, double weight, int first, int second) {
+    for (size_t i = 0; i < out[u].size(); ++i) {
+      if (out[u][i].node == w) {
+        int old = out[u][i].arc;
+        if (arcWeight[old] <= weight) {
+          return false;
+        }
+        int a = arcSource.size();
+        arcSource.push_back(u);
+        arcTarget.push_back(w);
+        arcWeight.push_back(weight);
+        arcFirst.push_back(first);
+        arcSecond.push_back(second);
+        out[u][i].arc = a;
+        for (size_t j = 0; j < in[w].size(); ++j) {
+          if (in[w][j].node == u) {
+            in[w][j].arc = a;
+          }
+        }
+        return true;
+      }
+    }
+    int a = arcSource.size();
+    arcSource.push_back(u);
+    arcTarget.push_back(w);
+    arcWeight.push_back(weight);
+    arcFirst.push_back(first);
+    arcSecond.push_back(second);
+    Edge e = {w, a};
+    out[u].push_back(e);
+    Edge f = {u, a};
+    in[w].push_back(f);
+    return true;
+  };
+
+  int NUM_ARCS = arcSources.size();
+  for (int i = 0; i < NUM_ARCS; ++i) {
+    if (arcSources[i] != arcTargets[i]) {
+      addArc(arcSources[i] - 1, arcTargets[i] - 1, arcDistances[i], -1, -1);
+    }
+  }
+
+  std::vector<bool> contracted(n, false);
+  std::vector<int> contractedNeighbors(n, 0);
+  std::vector<int> level(n, 0);
+  std::vector<double> dist(n, INF);
+  std::vector<int> touched;
+  std::vector<Entry> heap;
+  std::vector<int> targetStamp(n, 0);
+  int stamp = 0;
+
+  // Shortest distance from `source` to every node within `limit`, avoiding
+  // `skip` and contracted nodes, left in `dist` (reset via `touched`). The
+  // search also stops once the `numTargets` nodes marked with the current
+  // `stamp` are settled.
+  auto witnessSearch = [&](int source, int skip, double limit,
+                           int numTargets, int settleLimit) {
+    for (size_t i = 0; i < touched.size(); ++i) {
+      dist[touched[i]] = INF;
+    }
+    touched.clear();
+    heap.clear();
+    dist[source] = 0;
+    touched.push_back(source);
+    heap.push_back(Entry(0, source));
+    int settled = 0;
+    while (!heap.empty() && settled < settleLimit && numTargets > 0) {
+      std::pop_heap(heap.begin(), heap.end(), std::greater<Entry>());
+      Entry top = heap.back();
+      heap.pop_back();
+      if (top.first > dist[top.second]) {
+        continue;
+      }
+      if (top.first > limit) {
+        break;
+      }
+      ++settled;
+      if (targetStamp[top.second] == stamp) {
+        --numTargets;
+      }
+      const std::vector<Edge> &edges = out[top.second];
+      for (size_t i = 0; i < edges.size(); ++i) {
+        int w = edges[i].node;
+        if (w == skip || contracted[w]) {
+          continue;
+        }
+        double d = top.first + arcWeight[edges[i].arc];
+        if (d < dist[w]) {
+          if (dist[w] == INF) {
+            touched.push_back(w);
+          }
+          dist[w] = d;
+          heap.push_back(Entry(d, w));
+          std::push_heap(heap.begin(), heap.end(), std::greater<Entry>());
+        }
+      }
+    }
+  };
+
+  // Counts (or, if `apply`, adds) the shortcuts needed to contract v.
+  auto shortcuts = [&](int v, bool apply) {
+    int count = 0;
+    for (size_t i = 0; i < in[v].size(); ++i) {
+      int u = in[v][i].node;
+      double toV = arcWeight[in[v][i].arc];
+      double limit = 0;
+      int numTargets = 0;
+      ++stamp;
+      for (size_t j = 0; j < out[v].size(); ++j) {
+        if (out[v][j].node != u) {
+          limit = std::max(limit, toV + arcWeight[out[v][j].arc]);
+          targetStamp[out[v][j].node] = stamp;
+          ++numTargets;
+        }
+      }
+      witnessSearch(u, v, limit, numTargets,
+                    apply ? WITNESS_SETTLE_LIMIT : ESTIMATE_SETTLE_LIMIT);
+      for (size_t j = 0; j < out[v].size(); ++j) {
+        int w = out[v][j].node;
+        double through = toV + arcWeight[out[v][j].arc];
+        if (w == u || dist[w] <= through) {
+          continue;
+        }
+        ++count;
+        if (apply) {
+          addArc(u, w, through, in[v][i].arc, out[v][j].arc);
+        }
+      }
+    }
+    return count;
+  };
+
+  auto priority = [&](int v) {
+    return (long long)shortcuts(v, false) - (long long)in[v].size() -
+           (long long)out[v].size() + contractedNeighbors[v] + level[v];
+  };
+
+  MinQueue order;
+  for (int v = 0; v < n; ++v) {
+    order.push(Entry(priority(v), v));
+  }
+
+  // Arcs still attached to a node when it is contracted are the ones kept
+  // in the hierarchy; shortcuts later replaced by shorter ones are dropped.
+  std::vector<bool> keep;
+  ch.numNodes = n;
+  ch.rank.assign(n, 0);
+  int nextRank = 0;
+  while (!order.empty()) {
+    int v = order.top().second;
+    order.pop();
+    long long p = priority(v);
+    if (!order.empty() && p > order.top().first) {
+      order.push(Entry(p, v));
+      continue;
+    }
+
+    shortcuts(v, true);
+    keep.resize(arcSource.size(), false);
+    for (size_t i = 0; i < out[v].size(); ++i) {
+      keep[out[v][i].arc] = true;
+    }
+    for (size_t i = 0; i < in[v].size(); ++i) {
+      keep[in[v][i].arc] = true;
+    }
+
+    // Detach v from its neighbours.
+    for (size_t i = 0; i < out[v].size(); ++i) {
+      int w = out[v][i].node;
+      std::vector<Edge> &edges = in[w];
+      for (size_t j = 0; j < edges.size(); ++j) {
+        if (edges[j].node == v) {
+          edges[j] = edges.back();
+          edges.pop_back();
+          break;
+        }
+      }
+      ++contractedNeighbors[w];
+      level[w] = std::max(level[w], level[v] + 1);
+    }
+    for (size_t i = 0; i < in[v].size(); ++i) {
+      int u = in[v][i].node;
+      std::vector<Edge> &edges = out[u];
+      for (size_t j = 0; j < edges.size(); ++j) {
+        if (edges[j].node == v) {
+          edges[j] = edges.back();
+          edges.pop_back();
+          break;
+        }
+      }
+      ++contractedNeighbors[u];
+      level[u] = std::max(level[u], level[v] + 1);
+    }
+    std::vector<Edge>().swap(out[v]);
+    std::vector<Edge>().swap(in[v]);
+    contracted[v] = true;
+    ch.rank[v] = nextRank++;
+  }
+
+  // Compact the kept arcs, renumbering the shortcut references.
+  std::vector<int> newIndex(arcSource.size(), -1);
+  for (size_t a = 0; a < arcSource.size(); ++a) {
+    if (keep[a]) {
+      newIndex[a] = ch.arcSource.size();
+      ch.arcSource.push_back(arcSource[a]);
+      ch.arcTarget.push_back(arcTarget[a]);
+      ch.arcWeight.push_back(arcWeight[a]);
+      ch.arcFirst.push_back(arcFirst[a]);
+      ch.arcSecond.push_back(arcSecond[a]);
+    }
+  }
+  for (size_t a = 0; a < ch.arcFirst.size(); ++a) {
+    if (ch.arcFirst[a] >= 0) {
+      ch.arcFirst[a] = newIndex[ch.arcFirst[a]];
+      ch.arcSecond[a] = newIndex[ch.arcSecond[a]];
+    }
+  }
+  IndexHierarchy(ch);
+}
+
+// Scratch space for one query at a time; a worker reuses it across queries.
+struct HierarchyQuery {
+  std::vector<double> distForward;
+  std::vector<double> distBackward;
+  std::vector<int> predForward;
+  std::vector<int> predBackward;
+  std::vector<int> touched;
+
+  explicit HierarchyQuery(int n)
+      : distForward(n, std::numeric_limits<double>::infinity()),
+        distBackward(n, std::numeric_limits<double>::infinity()),
+        predForward(n, -1), predBackward(n, -1) {}
+};
+
+// Appends the nodes of arc `a`, expanded down to input arcs, to `path`
+// (without the source of `a`, which the caller has already added).
+inline void UnpackArc(const ContractionHierarchy &ch, int a,
+                      std::vector<int> &path) {
+  std::vector<int> stack(1, a);
+  while (!stack.empty()) {
+    int b = stack.back();
+    stack.pop_back();
+    if (ch.arcFirst[b] < 0) {
+      path.push_back(ch.arcTarget[b] + 1);
+    } else {
+      stack.push_back(ch.arcSecond[b]);
+      stack.push_back(ch.arcFirst[b]);
+    }
+  }
+}
+
+// Distance from node s to node t (0-indexed) in `ch`, or -1 if t cannot be
+// reached. A Dijkstra search runs upwards from s and another runs upwards
+// from t on the reversed arcs; the shortest path is the best node reached
+// by both. Each search stops once its queue minimum is no better than the
+// best path found. If `path` is given, the unpacked path is stored there.
+inline double QueryHierarchy(const ContractionHierarchy &ch,
+                             HierarchyQuery &q, int s, int t,
+                             std::vector<int> *path) {
+  const double INF = std::numeric_limits<double>::infinity();
+  typedef std::pair<double, int> Entry;
+  typedef std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry> >
+      MinQueue;
+
+  for (size_t i = 0; i < q.touched.size(); ++i) {
+    int v = q.touched[i];
+    q.distForward[v] = q.distBackward[v] = INF;
+    q.predForward[v] = q.predBackward[v] = -1;
+  }
+  q.touched.clear();
+
+  MinQueue forward, backward;
+  q.distForward[s] = 0;
+  q.distBackward[t] = 0;
+  q.touched.push_back(s);
+  q.touched.push_back(t);
+  forward.push(Entry(0, s));
+  backward.push(Entry(0, t));
+  double best = INF;
+  int meet = -1;
+  if (s == t) {
+    best = 0;
+    meet = s;
+  }
+
+  while (true) {
+    bool forwardDone = forward.empty() || forward.top().first >= best;
+    bool backwardDone = backward.empty() || backward.top().first >= best;
+    if (forwardDone && backwardDone) {
+      break;
+    }
+    bool isForward = !forwardDone &&
+                     (backwardDone ||
+                      forward.top().first <= backward.top().first);
+    MinQueue &queue = isForward ? forward : backward;
+    std::vector<double> &dist = isForward ? q.distForward : q.distBackward;
+    std::vector<double> &other = isForward ? q.distBackward : q.distForward;
+    std::vector<int> &pred = isForward ? q.predForward : q.predBackward;
+    const std::vector<int> &first = isForward ? ch.upFirst : ch.downFirst;
+    const std::vector<int> &arcs = isForward ? ch.upArcs : ch.downArcs;
+    const std::vector<int> &ends = isForward ? ch.arcTarget : ch.arcSource;
+    // Arcs reaching v from higher ranked nodes in this search direction.
+    const std::vector<int> &stallFirst = isForward ? ch.downFirst : ch.upFirst;
+    const std::vector<int> &stallArcs = isForward ? ch.downArcs : ch.upArcs;
+    const std::vector<int> &stallEnds = isForward ? ch.arcSource : ch.arcTarget;
+
+    Entry top = queue.top();
+    queue.pop();
+    int v = top.second;
+    if (top.first > dist[v]) {
+      continue;
+    }
+    // Stall-on-demand: if a higher ranked node already reached offers a
+    // shorter way into v, v cannot be on a shortest up-down path with its
+    // current distance, so there is no point in expanding it.
+    bool stalled = false;
+    for (int i = stallFirst[v]; i < stallFirst[v + 1] && !stalled; ++i) {
+      int a = stallArcs[i];
+      double d = dist[stallEnds[a]];
+      stalled = d != INF && d + ch.arcWeight[a] < top.first;
+    }
+    if (stalled) {
+      continue;
+    }
+    if (other[v] != INF && top.first + other[v] < best) {
+      best = top.first + other[v];
+      meet = v;
+    }
+    for (int i = first[v]; i < first[v + 1]; ++i) {
+      int a = arcs[i];
+      int w = ends[a];
+      double d = top.first + ch.arcWeight[a];
+      if (d < dist[w]) {
+        if (q.distForward[w] == INF && q.distBackward[w] == INF) {
+          q.touched.push_back(w);
+        }
+        dist[w] = d;
+        pred[w] = a;
+        queue.push(Entry(d, w));
+      }
+    }
+  }
+
+  if (meet < 0) {
+    return -1;
+  }
+  if (path != NULL) {
+    std::vector<int> up;
+    for (int v = meet; v != s; v = ch.arcSource[q.predForward[v]]) {
+      up.push_back(q.predForward[v]);
+    }
+    path->assign(1, s + 1);
+    for (int i = up.size() - 1; i >= 0; --i) {
+      UnpackArc(ch, up[i], *path);
+    }
+    for (int v = meet; v != t; v = ch.arcTarget[q.predBackward[v]]) {
+      UnpackArc(ch, q.predBackward[v], *path);
+    }
+  }
+  return best;
+}
+
+inline ContractionHierarchy &GetHierarchy(SEXP index) {
+  Rcpp::XPtr<ContractionHierarchy> ptr(index);
+  if (ptr.get() == NULL) {
+    Rcpp::stop("The contraction hierarchy is no longer valid (was it saved "
+               "with saveRDS()?); use SaveContractionHierarchy() and "
+               "LoadContractionHierarchy() instead.");
+  }
+  return *ptr;
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+SEXP ContractionHierarchyRunner(std::vector<int> arcSources,
+                                std::vector<int> arcTargets,
+                                std::vector<double> arcDistances,
+                                int numNodes) {
+  Rcpp::XPtr<ContractionHierarchy> ptr(new ContractionHierarchy(), true);
+  BuildHierarchy(*ptr, arcSources, arcTargets, arcDistances, numNodes);
+  return ptr;
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List ContractionHierarchyQueryRunner(SEXP index,
+                                           std::vector<int> startNodes,
+                                           std::vector<int> endNodes,
+                                           bool paths, int numThreads) {
+  const ContractionHierarchy &ch = GetHierarchy(index);
+  int numQueries = startNodes.size();
+  int numWorkers = NumWorkers(numThreads, numQueries);
+  std::vector<HierarchyQuery> workers(numWorkers,
+                                      HierarchyQuery(ch.numNodes));
+  std::vector<double> found(numQueries);
+  std::vector<std::vector<int> > nodePaths(paths ? numQueries : 0);
+  ParallelFor(numQueries, numWorkers, [&](int task, int worker) {
+    found[task] = QueryHierarchy(ch, workers[worker], startNodes[task] - 1,
+                                 endNodes[task] - 1,
+                                 paths ? &nodePaths[task] : NULL);
+  });
+
+  Rcpp::NumericVector distances(numQueries);
+  for (int i = 0; i < numQueries; ++i) {
+    distances[i] = found[i] < 0 ? R_PosInf : found[i];
+  }
+  if (!paths) {
+    return Rcpp::List::create(distances, R_NilValue);
+  }
+  Rcpp::List pathList(numQueries);
+  for (int i = 0; i < numQueries; ++i) {
+    pathList[i] = Rcpp::wrap(nodePaths[i]);
+  }
+  return Rcpp::List::create(distances, pathList);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List ContractionHierarchyExportRunner(SEXP index) {
+  const ContractionHierarchy &ch = GetHierarchy(index);
+  std::vector<int> rank(ch.rank), sources(ch.arcSource),
+      targets(ch.arcTarget), first(ch.arcFirst), second(ch.arcSecond);
+  for (size_t a = 0; a < sources.size(); ++a) {
+    ++sources[a];
+    ++targets[a];
+    ++first[a];
+    ++second[a];
+  }
+  std::vector<double> weights(ch.arcWeight.begin(), ch.arcWeight.end());
+  return Rcpp::List::create(ch.numNodes, rank, sources, targets, weights,
+                            first, second);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+SEXP ContractionHierarchyImportRunner(int numNodes, std::vector<int> rank,
+                                      std::vector<int> arcSources,
+                                      std::vector<int> arcTargets,
+                                      std::vector<double> arcWeights,
+                                      std::vector<int> arcFirst,
+                                      std::vector<int> arcSecond) {
+  size_t NUM_ARCS = arcSources.size();
+  if ((int)rank.size() != numNodes || arcTargets.size() != NUM_ARCS ||
+      arcWeights.size() != NUM_ARCS || arcFirst.size() != NUM_ARCS ||
+      arcSecond.size() != NUM_ARCS) {
+    Rcpp::stop("Inconsistent contraction hierarchy data.");
+  }
+  Rcpp::XPtr<ContractionHierarchy> ptr(new ContractionHierarchy(), true);
+  ContractionHierarchy &ch = *ptr;
+  ch.numNodes = numNodes;
+  ch.rank = rank;
+  ch.arcSource.resize(NUM_ARCS);
+  ch.arcTarget.resize(NUM_ARCS);
+  ch.arcWeight.resize(NUM_ARCS);
+  ch.arcFirst.resize(NUM_ARCS);
+  ch.arcSecond.resize(NUM_ARCS);
+  // The ranks must be a permutation of the nodes.
+  std::vector<char> ranked(numNodes, 0);
+  for (int v = 0; v < numNodes; ++v) {
+    if (rank[v] < 0 || rank[v] >= numNodes || ranked[rank[v]]) {
+      Rcpp::stop("Inconsistent contraction hierarchy data.");
+    }
+    ranked[rank[v]] = 1;
+  }
+  // An arc is an input arc, with no parts, or a shortcut through two arcs
+  // before it that join up from its source to its target, as built by
+  // BuildHierarchy(); anything else could send UnpackArc() out of bounds or
+  // round in circles.
+  for (size_t a = 0; a < NUM_ARCS; ++a) {
+    if (arcSources[a] < 1 || arcSources[a] > numNodes || arcTargets[a] < 1 ||
+        arcTargets[a] > numNodes || !std::isfinite(arcWeights[a]) ||
+        arcWeights[a] < 0) {
+      Rcpp::stop("Inconsistent contraction hierarchy data.");
+    }
+    int first = arcFirst[a], second = arcSecond[a];
+    if (first != 0 || second != 0) {
+      if (first < 1 || first > (int)a || second < 1 || second > (int)a ||
+          arcSources[first - 1] != arcSources[a] ||
+          arcTargets[first - 1] != arcSources[second - 1] ||
+          arcTargets[second - 1] != arcTargets[a]) {
+        Rcpp::stop("Inconsistent contraction hierarchy data.");
+      }
+    }
+    ch.arcSource[a] = arcSources[a] - 1;
+    ch.arcTarget[a] = arcTargets[a] - 1;
+    ch.arcWeight[a] = arcWeights[a];
+    ch.arcFirst[a] = arcFirst[a] - 1;
+    ch.arcSecond[a] = arcSecond[a] - 1;
+  }
+  IndexHierarchy(ch);
+  return ptr;
+}
@@ -0,0 +1,88 @@
+#ifndef RLEMON_GRAPH_HANDLE_H
+#define RLEMON_GRAPH_HANDLE_H
+
+#include "lemon/static_graph.h"
+#include <Rcpp.h>
+#include <utility>
+#include <vector>
+
+using namespace lemon;
+
+// A directed graph built once from the arc vectors passed in from R. The
+// exported functions accept it, wrapped in an external pointer, in place of
+// arcSources/arcTargets/numNodes so that repeated queries against the same
+// network only pay for the graph construction once.
+//
+// The graph is stored as a StaticDigraph (a compressed, CSR-like layout)
+// since none of the algorithms run on it modify the graph. StaticDigraph
+// numbers its arcs in order of their source node, so `arcs` maps the i-th
+// arc given from R to the corresponding arc of `g`, keeping arc-indexed
+// inputs and outputs in the caller's order.
+struct DigraphHandle {
+  typedef StaticDigraph Digraph;
+
+  Digraph g;
+  std::vector<Digraph::Node> nodes;
+  std::vector<Digraph::Arc> arcs;
+};
+
+// Fills `h` with the graph given by the 1-indexed arcSources/arcTargets.
+inline void BuildDigraph(DigraphHandle &h, const std::vector<int> &arcSources,
+                         const std::vector<int> &arcTargets, int numNodes) {
+  typedef DigraphHandle::Digraph Digraph;
+  int NUM_ARCS = arcSources.size();
+
+  // Counting sort of the arcs by source node, as StaticDigraph::build()
+  // requires. Each bucket is filled from its end so that the out-arcs of a
+  // node are visited in the same (reverse insertion) order as in ListDigraph,
+  // which keeps traversal-dependent outputs close to the previous behavior.
+  std::vector<int> bucketEnd(numNodes + 1, 0);
+  for (int i = 0; i < NUM_ARCS; ++i) {
+    ++bucketEnd[arcSources[i]];
+  }
+  for (int i = 0; i < numNodes; ++i) {
+    bucketEnd[i + 1] += bucketEnd[i];
+  }
+
+  std::vector<std::pair<int, int> > sortedArcs(NUM_ARCS);
+  std::vector<int> position(NUM_ARCS);
+  for (int i = 0; i < NUM_ARCS; ++i) {
+    int k = --bucketEnd[arcSources[i]];
+    sortedArcs[k] = std::make_pair(arcSources[i] - 1, arcTargets[i] - 1);
+    position[i] = k;
+  }
+  h.g.build(numNodes, sortedArcs.begin(), sortedArcs.end());
+
+  h.nodes.resize(numNodes);
+  for (int i = 0; i < numNodes; ++i) {
+    h.nodes[i] = Digraph::node(i);
+  }
+  h.arcs.resize(NUM_ARCS);
+  for (int i = 0; i < NUM_ARCS; ++i) {
+    h.arcs[i] = Digraph::arc(position[i]);
+  }
+}
+
+// Unwraps a graph built by GraphHandleRunner. The pointer is cleared when a
+// graph is serialized, e.g. by saveRDS(), so that case is reported here
+// rather than crashing.
+inline DigraphHandle &GetDigraph(SEXP graph) {
+  Rcpp::XPtr<DigraphHandle> ptr(graph);
+  if (ptr.get() == NULL) {
+    Rcpp::stop("The graph is no longer valid (was it saved and reloaded?); "
+               "rebuild it with BuildGraph().");
+  }
+  return *ptr;
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+SEXP GraphHandleRunner(std::vector<int> arcSources,
+                       std::vector<int> arcTargets, int numNodes) {
+  // The handle is released by R's garbage collector via the XPtr finalizer.
+  Rcpp::XPtr<DigraphHandle> ptr(new DigraphHandle(), true);
+  BuildDigraph(*ptr, arcSources, arcTargets, numNodes);
+  return ptr;
+}
+
+#endif // RLEMON_GRAPH_HANDLE_H
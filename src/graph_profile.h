@@ -0,0 +1,172 @@
+#ifndef RLEMON_GRAPH_PROFILE_H
+#define RLEMON_GRAPH_PROFILE_H
+
+#include "strong_components.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+// Finds at once the properties of a graph given as a list of arcs that the
+// Is*Runner and Count*ComponentsRunner functions of connectivity.h each
+// find on a graph of their own. The arcs are read both as a directed graph
+// and as an undirected one, as by UndirectedView, and the results agree
+// with LEMON's on those.
+//
+// The graph is stored once, as compressed rows of the out-arcs and of the
+// edges at each node. One depth-first search of the undirected graph,
+// without recursion, gives its connected components, two-colors it and
+// finds the lowest node reached from each subtree, from which the bridges
+// and the blocks follow. An acyclic undirected graph has exactly
+// numNodes - components edges, and the bi-edge-connected components are the
+// connected components less their bridges. The directed properties come from
+// one IterativeStrongComponents search of the out-arcs: a graph is a DAG
+// when every strongly connected component is a single node without a loop.
+class GraphProfile {
+public:
+  // The graph has nodes 1 to numNodes, as passed from R, and the arcs
+  // sources[i] -> targets[i].
+  GraphProfile(int numNodes, const std::vector<int> &sources,
+               const std::vector<int> &targets)
+      : numNodes(numNodes), sources(sources), targets(targets) {}
+
+  void run() {
+    int numArcs = sources.size();
+    std::vector<int> outFirst, outHeads;
+    BuildArcRows(numNodes, sources, targets, false, outFirst, outHeads);
+    IterativeStrongComponents strong(numNodes, sources, targets);
+    strong.run(outFirst, outHeads);
+    strongCount = strong.componentNum();
+
+    // The edges at node v are entries first[v] up to first[v + 1] - 1,
+    // leading to ends[] along edges[]; a loop is there twice.
+    std::vector<int> first(numNodes + 1, 0), ends(2 * numArcs),
+        edges(2 * numArcs);
+    int loops = 0;
+    for (int i = 0; i < numArcs; ++i) {
+      ++first[sources[i] - 1];
+      ++first[targets[i] - 1];
+      if (sources[i] == targets[i]) {
+        ++loops;
+      }
+    }
+    for (int v = 1; v < numNodes; ++v) {
+      first[v] += first[v - 1];
+    }
+    for (int i = 0; i < numArcs; ++i) {
+      int s = sources[i] - 1, t = targets[i] - 1;
+      --first[s];
+      ends[first[s]] = t;
+      edges[first[s]] = i;
+      --first[t];
+      ends[first[t]] = s;
+      edges[first[t]] = i;
+    }
+    first[numNodes] = 2 * numArcs;
+
+    // Two entries of a node leading to the same node are parallel edges,
+    // which includes the two entries of a loop.
+    parallelFree = true;
+    bool evenDegrees = true, hasIsolated = false;
+    std::vector<int> mark(numNodes, -1);
+    for (int v = 0; v < numNodes; ++v) {
+      int degree = first[v + 1] - first[v];
+      evenDegrees = evenDegrees && degree % 2 == 0;
+      hasIsolated = hasIsolated || degree == 0;
+      for (int a = first[v]; a < first[v + 1]; ++a) {
+        if (mark[ends[a]] == v) {
+          parallelFree = false;
+        }
+        mark[ends[a]] = v;
+      }
+    }
+
+    // Each loop is a block of its own.
+    int bridges = 0;
+    connectedCount = 0;
+    biNodeCount = loops;
+    bipartite = true;
+    std::vector<int> order(numNodes, -1), low(numNodes), parentEdge(numNodes);
+    std::vector<char> side(numNodes);
+    std::vector<std::pair<int, int> > path;
+    int time = 0;
+    for (int start = numNodes - 1; start >= 0; --start) {
+      if (order[start] != -1) {
+        continue;
+      }
+      ++connectedCount;
+      order[start] = low[start] = time++;
+      parentEdge[start] = -1;
+      side[start] = 0;
+      path.push_back(std::make_pair(start, first[start]));
+      while (!path.empty()) {
+        int v = path.back().first, a = path.back().second;
+        if (a < first[v + 1]) {
+          ++path.back().second;
+          int w = ends[a];
+          if (order[w] == -1) {
+            order[w] = low[w] = time++;
+            parentEdge[w] = edges[a];
+            side[w] = !side[v];
+            path.push_back(std::make_pair(w, first[w]));
+            continue;
+          }
+          if (side[w] == side[v]) {
+            bipartite = false;
+          }
+          if (edges[a] != parentEdge[v]) {
+            low[v] = std::min(low[v], order[w]);
+          }
+          continue;
+        }
+        path.pop_back();
+        if (!path.empty()) {
+          int u = path.back().first;
+          low[u] = std::min(low[u], low[v]);
+          if (low[v] > order[u]) {
+            ++bridges;
+          }
+          if (low[v] >= order[u]) {
+            ++biNodeCount;
+          }
+        }
+      }
+    }
+    biEdgeCount = connectedCount + bridges;
+
+    connected = connectedCount <= 1;
+    acyclic = numArcs == numNodes - connectedCount;
+    loopFree = loops == 0;
+    eulerian = evenDegrees && connected;
+    // By LEMON's definition, an isolated node and any other node are not
+    // bi-node-connected.
+    biNodeConnected = !(hasIsolated && numNodes > 1) && biNodeCount <= 1;
+    dag = strongCount == numNodes && loopFree;
+  }
+
+  bool isConnected() const { return connected; }
+  bool isAcyclic() const { return acyclic; }
+  bool isTree() const { return connected && acyclic; }
+  bool isBipartite() const { return bipartite; }
+  bool isStronglyConnected() const { return strongCount <= 1; }
+  bool isDAG() const { return dag; }
+  bool isBiNodeConnected() const { return biNodeConnected; }
+  bool isBiEdgeConnected() const { return biEdgeCount <= 1; }
+  bool isLoopFree() const { return loopFree; }
+  bool isParallelFree() const { return parallelFree; }
+  bool isSimpleGraph() const { return parallelFree && loopFree; }
+  bool isEulerian() const { return eulerian; }
+  int connectedComponentNum() const { return connectedCount; }
+  int stronglyConnectedComponentNum() const { return strongCount; }
+  int biNodeConnectedComponentNum() const { return biNodeCount; }
+  int biEdgeConnectedComponentNum() const { return biEdgeCount; }
+
+private:
+  int numNodes;
+  const std::vector<int> &sources, &targets;
+  bool connected, acyclic, bipartite, dag, biNodeConnected, loopFree,
+      parallelFree, eulerian;
+  int connectedCount, strongCount, biNodeCount, biEdgeCount;
+};
+
+#endif // RLEMON_GRAPH_PROFILE_H
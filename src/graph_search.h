@@ -1,8 +1,10 @@
+#include "graph_handle.h"
 #include "lemon/bfs.h"
 #include "lemon/dfs.h"
 #include "lemon/dijkstra.h"
 #include "lemon/list_graph.h"
 #include "lemon/suurballe.h"
+#include "value_type.h"
 #include <lemon/max_cardinality_search.h>
 
 #include <Rcpp.h>
@@ -13,33 +15,20 @@ typedef int Value;
 using namespace lemon;
 using namespace std;
 
-//' @rdname lemon_runners
-// [[Rcpp::export]]
-Rcpp::List BfsRunner(std::vector<int> arcSources, std::vector<int> arcTargets,
-                     int numNodes, int startNode = -1, int endNode = -1) {
-  ListDigraph g;
-  std::vector<ListDigraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
+// Runs a graph search (Bfs or Dfs) on `h`. startNode and endNode are
+// optional; -1 means "not given".
+template <typename Search>
+inline Rcpp::List RunGraphSearch(const DigraphHandle &h, int startNode,
+                                 int endNode) {
+  const DigraphHandle::Digraph &g = h.g;
+  int numNodes = h.nodes.size();
 
-  std::vector<ListDigraph::Arc> arcs;
-
-  int NUM_ARCS = arcSources.size();
-
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    ListDigraph::Arc a =
-        g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    arcs.push_back(a);
-  }
-
-  Bfs<ListDigraph> runner(g);
+  Search runner(g);
 
   if (startNode != -1 && endNode != -1) {
-    runner.run(nodes[startNode - 1], nodes[endNode - 1]);
+    runner.run(h.nodes[startNode - 1], h.nodes[endNode - 1]);
   } else if (startNode != -1) {
-    runner.run(nodes[startNode - 1]);
+    runner.run(h.nodes[startNode - 1]);
   } else {
     runner.run();
   }
@@ -49,9 +38,9 @@ Rcpp::List BfsRunner(std::vector<int> arcSources, std::vector<int> arcTargets,
   std::vector<int> nodeReached;
 
   for (int i = 0; i < numNodes; ++i) {
-    nodePreds.push_back(g.id(runner.predNode(nodes[i])) + 1);
-    nodeDistances.push_back(runner.dist(nodes[i]));
-    if (runner.reached(nodes[i])) {
+    nodePreds.push_back(g.id(runner.predNode(h.nodes[i])) + 1);
+    nodeDistances.push_back(runner.dist(h.nodes[i]));
+    if (runner.reached(h.nodes[i])) {
       nodeReached.push_back(1);
     } else {
       nodeReached.push_back(0);
@@ -63,58 +52,43 @@ Rcpp::List BfsRunner(std::vector<int> arcSources, std::vector<int> arcTargets,
 
 //' @rdname lemon_runners
 // [[Rcpp::export]]
-Rcpp::List DfsRunner(std::vector<int> arcSources, std::vector<int> arcTargets,
+Rcpp::List BfsRunner(std::vector<int> arcSources, std::vector<int> arcTargets,
                      int numNodes, int startNode = -1, int endNode = -1) {
-  ListDigraph g;
-  std::vector<ListDigraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-
-  std::vector<ListDigraph::Arc> arcs;
-
-  int NUM_ARCS = arcSources.size();
-
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    ListDigraph::Arc a =
-        g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    arcs.push_back(a);
-  }
-
-  Dfs<ListDigraph> runner(g);
-
-  if (startNode != -1 && endNode != -1) {
-    runner.run(nodes[startNode - 1], nodes[endNode - 1]);
-  } else if (startNode != -1) {
-    runner.run(nodes[startNode - 1]);
-  } else {
-    runner.run();
-  }
-
-  std::vector<int> nodePreds;
-  std::vector<int> nodeDistances;
-  std::vector<int> nodeReached;
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  return RunGraphSearch<Bfs<DigraphHandle::Digraph> >(h, startNode, endNode);
+}
 
-  for (int i = 0; i < numNodes; ++i) {
-    nodePreds.push_back(g.id(runner.predNode(nodes[i])) + 1);
-    nodeDistances.push_back(runner.dist(nodes[i]));
-    if (runner.reached(nodes[i])) {
-      nodeReached.push_back(1);
-    } else {
-      nodeReached.push_back(0);
-    }
-  }
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List BfsGraphRunner(SEXP graph, int startNode = -1, int endNode = -1) {
+  return RunGraphSearch<Bfs<DigraphHandle::Digraph> >(GetDigraph(graph),
+                                                      startNode, endNode);
+}
 
-  return Rcpp::List::create(nodePreds, nodeDistances, nodeReached);
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List DfsRunner(std::vector<int> arcSources, std::vector<int> arcTargets,
+                     int numNodes, int startNode = -1, int endNode = -1) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  return RunGraphSearch<Dfs<DigraphHandle::Digraph> >(h, startNode, endNode);
 }
 
 //' @rdname lemon_runners
 // [[Rcpp::export]]
-Rcpp::List MaxCardinalitySearchRunner(std::vector<int> arcSources,
-                                      std::vector<int> arcTargets,
-                                      std::vector<int> arcCapacities,
-                                      int numNodes, int startNode = -1) {
+Rcpp::List DfsGraphRunner(SEXP graph, int startNode = -1, int endNode = -1) {
+  return RunGraphSearch<Dfs<DigraphHandle::Digraph> >(GetDigraph(graph),
+                                                      startNode, endNode);
+}
+
+// Runs a maximum cardinality search with arc capacities of type `Value`.
+template <typename Value>
+inline Rcpp::List
+RunMaxCardinalitySearch(const std::vector<int> &arcSources,
+                        const std::vector<int> &arcTargets,
+                        const std::vector<double> &arcCapacities, int numNodes,
+                        int startNode) {
   ListDigraph g;
   std::vector<ListDigraph::Node> nodes;
   for (int i = 0; i < numNodes; ++i) {
@@ -123,7 +97,7 @@ Rcpp::List MaxCardinalitySearchRunner(std::vector<int> arcSources,
   }
 
   std::vector<ListDigraph::Arc> arcs;
-  ListDigraph::ArcMap<int> costs(g);
+  ListDigraph::ArcMap<Value> costs(g);
   int NUM_ARCS = arcSources.size();
 
   for (int i = 0; i < NUM_ARCS; ++i) {
@@ -133,7 +107,8 @@ Rcpp::List MaxCardinalitySearchRunner(std::vector<int> arcSources,
     arcs.push_back(a);
   }
 
-  MaxCardinalitySearch<ListDigraph, ListDigraph::ArcMap<int> > runner(g, costs);
+  MaxCardinalitySearch<ListDigraph, ListDigraph::ArcMap<Value> > runner(
+      g, costs);
 
   if (startNode != -1) {
     runner.run(nodes[startNode - 1]);
@@ -141,7 +116,7 @@ Rcpp::List MaxCardinalitySearchRunner(std::vector<int> arcSources,
     runner.run();
   }
 
-  std::vector<int> nodeCardinality;
+  std::vector<Value> nodeCardinality;
   std::vector<int> nodeDistances;
   std::vector<int> nodeReached;
 
@@ -156,3 +131,17 @@ Rcpp::List MaxCardinalitySearchRunner(std::vector<int> arcSources,
 
   return Rcpp::List::create(nodeCardinality, nodeReached);
 }
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List MaxCardinalitySearchRunner(std::vector<int> arcSources,
+                                      std::vector<int> arcTargets,
+                                      std::vector<double> arcCapacities,
+                                      int numNodes, int startNode = -1) {
+  if (IsIntegral(arcCapacities)) {
+    return RunMaxCardinalitySearch<int>(arcSources, arcTargets, arcCapacities,
+                                        numNodes, startNode);
+  }
+  return RunMaxCardinalitySearch<double>(arcSources, arcTargets, arcCapacities,
+                                         numNodes, startNode);
+}
@@ -0,0 +1,164 @@
+#ifndef RLEMON_HOPCROFT_KARP_H
+#define RLEMON_HOPCROFT_KARP_H
+
+#include <lemon/core.h>
+#include <limits>
+#include <vector>
+
+// Finds a maximum cardinality matching of a bipartite graph with Hopcroft
+// and Karp's algorithm, in O(E sqrt(V)) time.
+//
+// `red` gives the side of each node, as found by lemon::bipartitePartitions;
+// every edge must join the two sides. Each phase labels the red nodes by a
+// breadth-first search from the unmatched red nodes, and then augments the
+// matching along a maximal set of disjoint shortest augmenting paths, found
+// by depth-first searches (without recursion, so deep paths are fine). The
+// graph is first copied into arrays of the edges at each red node, and a
+// greedy matching is taken to start from.
+template <typename GR, typename RedMap> class HopcroftKarp {
+public:
+  typedef GR Graph;
+  typedef typename Graph::Node Node;
+  typedef typename Graph::Edge Edge;
+
+  HopcroftKarp(const Graph &graph, const RedMap &red)
+      : graph(graph), red(red) {}
+
+  void run() {
+    int numNodes = graph.maxNodeId() + 1;
+    mateNode.assign(numNodes, -1);
+    mateEdge.assign(numNodes, -1);
+    reds.clear();
+    adjFirst.assign(1, 0);
+    adjNode.clear();
+    adjEdge.clear();
+    for (typename Graph::NodeIt n(graph); n != lemon::INVALID; ++n) {
+      if (!red[n]) {
+        continue;
+      }
+      reds.push_back(graph.id(n));
+      for (typename Graph::IncEdgeIt e(graph, n); e != lemon::INVALID; ++e) {
+        adjNode.push_back(graph.id(graph.oppositeNode(n, e)));
+        adjEdge.push_back(graph.id(Edge(e)));
+      }
+      adjFirst.push_back(adjNode.size());
+    }
+    int numReds = reds.size();
+    // Positions of the red nodes in `reds`, by node id.
+    std::vector<int> position(numNodes, -1);
+    for (int i = 0; i < numReds; ++i) {
+      position[reds[i]] = i;
+    }
+
+    size = 0;
+    for (int i = 0; i < numReds; ++i) {
+      for (int a = adjFirst[i]; a < adjFirst[i + 1]; ++a) {
+        if (mateNode[adjNode[a]] == -1) {
+          Match(reds[i], a);
+          ++size;
+          break;
+        }
+      }
+    }
+
+    const int UNREACHED = std::numeric_limits<int>::max();
+    std::vector<int> dist(numReds), queue, next(numReds), stack;
+    while (true) {
+      // Label the red nodes by their distance from an unmatched one, up to
+      // the first layer with an edge to an unmatched node.
+      queue.clear();
+      for (int i = 0; i < numReds; ++i) {
+        dist[i] = mateNode[reds[i]] == -1 ? 0 : UNREACHED;
+        if (dist[i] == 0) {
+          queue.push_back(i);
+        }
+      }
+      int limit = UNREACHED;
+      for (size_t q = 0; q < queue.size(); ++q) {
+        int i = queue[q];
+        if (dist[i] >= limit) {
+          break;
+        }
+        for (int a = adjFirst[i]; a < adjFirst[i + 1]; ++a) {
+          int mate = mateNode[adjNode[a]];
+          if (mate == -1) {
+            limit = dist[i];
+          } else if (dist[position[mate]] == UNREACHED) {
+            dist[position[mate]] = dist[i] + 1;
+            queue.push_back(position[mate]);
+          }
+        }
+      }
+      if (limit == UNREACHED) {
+        break;
+      }
+
+      // Augment along disjoint shortest paths, following the labels.
+      for (int i = 0; i < numReds; ++i) {
+        next[i] = adjFirst[i];
+      }
+      for (int start = 0; start < numReds; ++start) {
+        if (dist[start] != 0 || mateNode[reds[start]] != -1) {
+          continue;
+        }
+        stack.assign(1, start);
+        while (!stack.empty()) {
+          int i = stack.back();
+          if (next[i] == adjFirst[i + 1]) {
+            dist[i] = UNREACHED;
+            stack.pop_back();
+            continue;
+          }
+          int a = next[i]++;
+          int mate = mateNode[adjNode[a]];
+          if (mate == -1) {
+            if (dist[i] != limit) {
+              continue;
+            }
+            // Each red node on the path takes the node its last edge leads
+            // to, leaving the next one's previous mate to the one before.
+            for (size_t k = 0; k < stack.size(); ++k) {
+              int j = stack[k];
+              Match(reds[j], next[j] - 1);
+              dist[j] = UNREACHED;
+            }
+            ++size;
+            stack.clear();
+          } else if (dist[position[mate]] == dist[i] + 1) {
+            stack.push_back(position[mate]);
+          }
+        }
+      }
+    }
+  }
+
+  int matchingSize() const { return size; }
+  bool matching(const Edge &edge) const {
+    int u = graph.id(graph.u(edge));
+    return mateEdge[u] != -1 && mateEdge[u] == graph.id(edge);
+  }
+  Node mate(const Node &node) const {
+    int m = mateNode[graph.id(node)];
+    return m == -1 ? Node(lemon::INVALID) : graph.nodeFromId(m);
+  }
+
+private:
+  const Graph &graph;
+  const RedMap &red;
+  // The red nodes, by id, and the edges at each: entries adjFirst[i] up to
+  // adjFirst[i + 1] are those at reds[i], with the node at their other end.
+  std::vector<int> reds, adjFirst, adjNode, adjEdge;
+  // The node each node is matched to and the edge matching it, by id.
+  std::vector<int> mateNode, mateEdge;
+  int size;
+
+  // Matches red node `u` along its adjacency entry `a`.
+  void Match(int u, int a) {
+    int v = adjNode[a];
+    mateNode[u] = v;
+    mateNode[v] = u;
+    mateEdge[u] = mateEdge[v] = adjEdge[a];
+  }
+};
+
+#endif // RLEMON_HOPCROFT_KARP_H
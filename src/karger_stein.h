@@ -0,0 +1,346 @@
+#ifndef RLEMON_KARGER_STEIN_H
+#define RLEMON_KARGER_STEIN_H
+
+#include "parallel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <lemon/bin_heap.h>
+#include <lemon/maps.h>
+#include <lemon/random.h>
+#include <utility>
+#include <vector>
+
+// Finds a minimum cut of an undirected graph with non-negative edge weights
+// by Karger and Stein's recursive random contraction, after first thinning
+// the graph to a Nagamochi-Ibaraki sparse certificate.
+//
+// The certificate is taken with k the smallest weighted degree, which
+// bounds the minimum cut from above: the edges are labelled by a maximum
+// adjacency ordering, and only the part of each edge's weight below k is
+// kept. This preserves every cut of weight less than k, and so the minimum
+// cut, while dropping most of the weight of dense graphs.
+//
+// Each repetition contracts the certificate at random, in proportion to the
+// edge weights, down to n / sqrt(2) nodes twice over and recurses on both.
+// Rather than recursing down to six nodes, graphs of up to EXACT_NODES
+// nodes are solved exactly by Stoer and Wagner's algorithm, which is much
+// faster than the many tiny contractions it replaces. One repetition finds
+// a given minimum cut with probability about 1 / log(n), so repeating it,
+// in parallel, makes the result exact with high probability. Each
+// repetition has its own lemon::Random, seeded from `seed` and its index,
+// so the result does not depend on the number of threads. The cuts found
+// are measured in the original graph, where the smallest degree is a cut
+// too.
+template <typename Value> class KargerStein {
+public:
+  // The graph has nodes 0 to numNodes - 1 (at least two) and the edges
+  // sources[i] - targets[i] of weight weights[i].
+  KargerStein(int numNodes, const std::vector<int> &sources,
+              const std::vector<int> &targets,
+              const std::vector<Value> &weights, int repetitions,
+              int numThreads, unsigned int seed)
+      : numNodes(numNodes), sources(sources), targets(targets),
+        weights(weights), repetitions(std::max(1, repetitions)),
+        numThreads(numThreads), seed(seed) {}
+
+  void run() {
+    Graph certificate;
+    SparseCertificate(certificate);
+
+    std::vector<Value> values(repetitions);
+    std::vector<std::vector<char> > sides(repetitions);
+    ParallelFor(repetitions, numThreads, [&](int task, int) {
+      Trial trial(seed + 7919u * task);
+      trial.Solve(certificate);
+      sides[task].swap(trial.bestSide);
+      values[task] = CutValue(sides[task]);
+    });
+
+    // The node of smallest degree on its own.
+    std::vector<Value> degree(numNodes, 0);
+    for (size_t e = 0; e < sources.size(); ++e) {
+      if (sources[e] != targets[e]) {
+        degree[sources[e]] += weights[e];
+        degree[targets[e]] += weights[e];
+      }
+    }
+    int lightest = std::min_element(degree.begin(), degree.end()) -
+                   degree.begin();
+    value = degree[lightest];
+    side.assign(numNodes, 0);
+    side[lightest] = 1;
+    for (int r = 0; r < repetitions; ++r) {
+      if (values[r] < value) {
+        value = values[r];
+        side.swap(sides[r]);
+      }
+    }
+  }
+
+  Value minCutValue() const { return value; }
+  bool minCut(int node) const { return side[node]; }
+
+private:
+  // Graphs of at most this many nodes are solved exactly rather than
+  // contracted further.
+  static const int EXACT_NODES = 24;
+
+  // An undirected multigraph as a list of edges.
+  struct Graph {
+    int numNodes = 0;
+    std::vector<int> u, v;
+    std::vector<Value> w;
+  };
+
+  // One repetition of the recursive contraction. `labels` maps the nodes
+  // of the graphs on the current path of the recursion back to the nodes of
+  // the one above, so the best cut can be expressed in the nodes of the
+  // certificate.
+  struct Trial {
+    lemon::Random rnd;
+    bool found = false;
+    Value best;
+    std::vector<char> bestSide;
+    std::vector<const std::vector<int> *> labels;
+
+    explicit Trial(unsigned int seed) : rnd(seed) {}
+
+    void Solve(const Graph &g) {
+      if (g.u.empty()) {
+        std::vector<char> cut(g.numNodes, 0);
+        cut[0] = 1;
+        Record(0, cut);
+      } else if (g.numNodes <= EXACT_NODES) {
+        SolveExactly(g);
+      } else {
+        int size = (int)std::ceil(1 + g.numNodes / std::sqrt(2.0));
+        for (int i = 0; i < 2; ++i) {
+          Graph h;
+          std::vector<int> label;
+          Contract(g, size, h, label);
+          labels.push_back(&label);
+          Solve(h);
+          labels.pop_back();
+        }
+      }
+    }
+
+    // Finds a minimum cut of a small graph exactly, by Stoer and Wagner's
+    // algorithm on its adjacency matrix.
+    void SolveExactly(const Graph &g) {
+      int n = g.numNodes;
+      std::vector<std::vector<Value> > adj(n, std::vector<Value>(n, 0));
+      for (size_t e = 0; e < g.u.size(); ++e) {
+        adj[g.u[e]][g.v[e]] += g.w[e];
+        adj[g.v[e]][g.u[e]] += g.w[e];
+      }
+      // The nodes of `g` merged into each remaining node.
+      std::vector<std::vector<int> > merged(n);
+      std::vector<int> active(n);
+      for (int x = 0; x < n; ++x) {
+        merged[x].push_back(x);
+        active[x] = x;
+      }
+      std::vector<Value> attached(n);
+      std::vector<char> added(n);
+      while (active.size() > 1) {
+        // A maximum adjacency order of the remaining nodes; the cut between
+        // the last node and the others is a minimum cut between the last
+        // two, which are then merged.
+        int size = active.size();
+        std::fill(added.begin(), added.end(), 0);
+        for (int i = 0; i < size; ++i) {
+          attached[active[i]] = 0;
+        }
+        int previous = -1, last = -1;
+        for (int step = 0; step < size; ++step) {
+          int next = -1;
+          for (int i = 0; i < size; ++i) {
+            int x = active[i];
+            if (!added[x] && (next == -1 || attached[x] > attached[next])) {
+              next = x;
+            }
+          }
+          added[next] = 1;
+          previous = last;
+          last = next;
+          for (int i = 0; i < size; ++i) {
+            attached[active[i]] += adj[next][active[i]];
+          }
+        }
+        if (!found || attached[last] < best) {
+          std::vector<char> sideOf(n, 0);
+          for (size_t i = 0; i < merged[last].size(); ++i) {
+            sideOf[merged[last][i]] = 1;
+          }
+          Record(attached[last], sideOf);
+        }
+        for (int i = 0; i < size; ++i) {
+          int x = active[i];
+          adj[previous][x] += adj[last][x];
+          adj[x][previous] = adj[previous][x];
+        }
+        adj[previous][previous] = 0;
+        merged[previous].insert(merged[previous].end(), merged[last].begin(),
+                                merged[last].end());
+        active.erase(std::find(active.begin(), active.end(), last));
+      }
+    }
+
+    void Record(Value cut, std::vector<char> sideOf) {
+      if (found && !(cut < best)) {
+        return;
+      }
+      for (size_t l = labels.size(); l-- > 0;) {
+        const std::vector<int> &label = *labels[l];
+        std::vector<char> above(label.size());
+        for (size_t x = 0; x < label.size(); ++x) {
+          above[x] = sideOf[label[x]];
+        }
+        sideOf.swap(above);
+      }
+      found = true;
+      best = cut;
+      bestSide.swap(sideOf);
+    }
+
+    // Contracts random edges of `g`, each chosen in proportion to its
+    // weight, until `size` nodes are left or no edges are, into `h`.
+    // label[x] is the node of `h` containing node x of `g`. Contracting in
+    // order of exponentially distributed times with rates the weights is
+    // the same as picking each next edge at random in proportion to its
+    // weight.
+    void Contract(const Graph &g, int size, Graph &h,
+                  std::vector<int> &label) {
+      int m = g.u.size();
+      std::vector<std::pair<double, int> > order(m);
+      for (int e = 0; e < m; ++e) {
+        order[e] = std::make_pair(rnd.exponential(g.w[e]), e);
+      }
+      std::sort(order.begin(), order.end());
+
+      std::vector<int> parent(g.numNodes);
+      for (int x = 0; x < g.numNodes; ++x) {
+        parent[x] = x;
+      }
+      auto find = [&](int x) {
+        while (parent[x] != x) {
+          parent[x] = parent[parent[x]];
+          x = parent[x];
+        }
+        return x;
+      };
+      int components = g.numNodes;
+      for (int i = 0; i < m && components > size; ++i) {
+        int a = find(g.u[order[i].second]), b = find(g.v[order[i].second]);
+        if (a != b) {
+          parent[a] = b;
+          --components;
+        }
+      }
+
+      label.assign(g.numNodes, -1);
+      h.numNodes = 0;
+      for (int x = 0; x < g.numNodes; ++x) {
+        int root = find(x);
+        if (label[root] == -1) {
+          label[root] = h.numNodes++;
+        }
+        label[x] = label[root];
+      }
+
+      // The edges left between different nodes, with parallel edges merged.
+      std::vector<std::pair<std::pair<int, int>, Value> > edges;
+      for (int e = 0; e < m; ++e) {
+        int a = label[g.u[e]], b = label[g.v[e]];
+        if (a != b) {
+          edges.push_back(std::make_pair(
+              std::make_pair(std::min(a, b), std::max(a, b)), g.w[e]));
+        }
+      }
+      std::sort(edges.begin(), edges.end(),
+                [](const std::pair<std::pair<int, int>, Value> &x,
+                   const std::pair<std::pair<int, int>, Value> &y) {
+                  return x.first < y.first;
+                });
+      for (size_t i = 0; i < edges.size(); ++i) {
+        if (i > 0 && edges[i].first == edges[i - 1].first) {
+          h.w.back() += edges[i].second;
+        } else {
+          h.u.push_back(edges[i].first.first);
+          h.v.push_back(edges[i].first.second);
+          h.w.push_back(edges[i].second);
+        }
+      }
+    }
+  };
+
+  int numNodes;
+  const std::vector<int> &sources, &targets;
+  const std::vector<Value> &weights;
+  int repetitions, numThreads;
+  unsigned int seed;
+  Value value;
+  std::vector<char> side;
+
+  // The weight of the edges crossing the cut given by `sideOf`.
+  Value CutValue(const std::vector<char> &sideOf) const {
+    Value cut = 0;
+    for (size_t e = 0; e < sources.size(); ++e) {
+      if (sideOf[sources[e]] != sideOf[targets[e]]) {
+        cut += weights[e];
+      }
+    }
+    return cut;
+  }
+
+  // Builds the sparse certificate of the graph, with k its smallest
+  // weighted degree, into `certificate`.
+  void SparseCertificate(Graph &certificate) const {
+    std::vector<std::vector<std::pair<int, int> > > incident(numNodes);
+    std::vector<Value> degree(numNodes, 0);
+    for (size_t e = 0; e < sources.size(); ++e) {
+      if (sources[e] != targets[e] && weights[e] > 0) {
+        incident[sources[e]].push_back(std::make_pair(targets[e], e));
+        incident[targets[e]].push_back(std::make_pair(sources[e], e));
+        degree[sources[e]] += weights[e];
+        degree[targets[e]] += weights[e];
+      }
+    }
+    Value k = *std::min_element(degree.begin(), degree.end());
+
+    // Maximum adjacency order: the next node is always the one most
+    // strongly attached to those before it. An edge's weight is stacked on
+    // its later end's attachment, and only the part of it below k is kept.
+    typedef lemon::RangeMap<int> HeapCrossRef;
+    HeapCrossRef crossRef(numNodes, -1);
+    typedef lemon::BinHeap<Value, HeapCrossRef, std::greater<Value> > Heap;
+    Heap heap(crossRef);
+    for (int x = 0; x < numNodes; ++x) {
+      heap.push(x, 0);
+    }
+    std::vector<Value> attached(numNodes, 0);
+    certificate.numNodes = numNodes;
+    while (!heap.empty()) {
+      int x = heap.top();
+      heap.pop();
+      for (size_t i = 0; i < incident[x].size(); ++i) {
+        int y = incident[x][i].first, e = incident[x][i].second;
+        if (heap.state(y) != Heap::IN_HEAP) {
+          continue;
+        }
+        if (attached[y] < k) {
+          certificate.u.push_back(x);
+          certificate.v.push_back(y);
+          certificate.w.push_back(std::min(weights[e], k - attached[y]));
+        }
+        attached[y] += weights[e];
+        heap.set(y, attached[y]);
+      }
+    }
+  }
+};
+
+#endif // RLEMON_KARGER_STEIN_H
@@ -0,0 +1,171 @@
+#ifndef RLEMON_LINEAR_ASSIGNMENT_H
+#define RLEMON_LINEAR_ASSIGNMENT_H
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+// Solves the linear assignment problem on a dense cost matrix: each of
+// numAgents agents is given a different one of numTargets targets
+// (numAgents <= numTargets), so that the total cost is smallest, or largest
+// when maximizing.
+//
+// This is the Hungarian method in its shortest augmenting path form, in
+// O(numAgents^2 numTargets) time. The costs of each agent are contiguous, so
+// every step of a search reads one agent's costs in order, and only for the
+// targets whose distance is not yet final. The duals start from the
+// cheapest costs of each target and agent, as in Jonker and Volgenant's
+// column reduction, and the agents take the free targets they are then
+// tight with, which settles most agents of typical problems before any
+// augmenting path is needed.
+class LinearAssignment {
+public:
+  // costs[a * numTargets + t] is the cost of giving agent a target t. The
+  // costs are read in place and must outlive the solver.
+  LinearAssignment(const double *costs, int numAgents, int numTargets,
+                   bool maximize)
+      : costs(costs), numAgents(numAgents), numTargets(numTargets),
+        sign(maximize ? -1.0 : 1.0) {}
+
+  void run() {
+    agentDual.assign(numAgents, 0);
+    targetDual.assign(numTargets, 0);
+    targetOf.assign(numAgents, -1);
+    agentOf.assign(numTargets, -1);
+
+    // Start from each target's cheapest cost over the agents, and then
+    // each agent's cheapest reduced cost, so every reduced cost is
+    // non-negative; agents then take free targets they are tight with.
+    // With more targets than agents, the targets left over must end with
+    // equal duals, no lower than the others, so theirs start at zero.
+    const double INF = std::numeric_limits<double>::infinity();
+    if (numAgents == numTargets) {
+      std::fill(targetDual.begin(), targetDual.end(), INF);
+      for (int a = 0; a < numAgents; ++a) {
+        const double *c = costs + (size_t)a * numTargets;
+        for (int t = 0; t < numTargets; ++t) {
+          targetDual[t] = std::min(targetDual[t], sign * c[t]);
+        }
+      }
+    }
+    for (int a = 0; a < numAgents; ++a) {
+      const double *c = costs + (size_t)a * numTargets;
+      double least = INF;
+      for (int t = 0; t < numTargets; ++t) {
+        least = std::min(least, sign * c[t] - targetDual[t]);
+      }
+      agentDual[a] = least;
+      for (int t = 0; t < numTargets; ++t) {
+        if (agentOf[t] == -1 && sign * c[t] - targetDual[t] == least) {
+          agentOf[t] = a;
+          targetOf[a] = t;
+          break;
+        }
+      }
+    }
+
+    dist.resize(numTargets);
+    pred.resize(numTargets);
+    todo.resize(numTargets);
+    for (int a = 0; a < numAgents; ++a) {
+      if (targetOf[a] == -1) {
+        Augment(a);
+      }
+    }
+
+    cost = 0;
+    for (int a = 0; a < numAgents; ++a) {
+      cost += costs[(size_t)a * numTargets + targetOf[a]];
+    }
+  }
+
+  double totalCost() const { return cost; }
+  // The target given to `agent`.
+  int target(int agent) const { return targetOf[agent]; }
+
+private:
+  const double *costs;
+  int numAgents, numTargets;
+  double sign;
+  double cost;
+  // Duals with every reduced cost, cost - agentDual - targetDual, at least
+  // zero, and zero on the assigned pairs.
+  std::vector<double> agentDual, targetDual;
+  std::vector<int> targetOf, agentOf;
+  // Scratch space for the searches: the distance of each target from the
+  // new agent in reduced costs, the agent it is reached from, the targets
+  // whose distance is not final (at the front), and the assigned targets
+  // whose distance is.
+  std::vector<double> dist;
+  std::vector<int> pred, todo, reached;
+
+  // Assigns the free agent `start` by a Dijkstra search for the nearest
+  // free target in reduced costs, then updates the duals and swaps the
+  // assignments along the path found.
+  void Augment(int start) {
+    const double INF = std::numeric_limits<double>::infinity();
+    std::fill(dist.begin(), dist.end(), INF);
+    reached.clear();
+
+    // Each step only reads the targets whose distance is not final.
+    int numTodo = numTargets;
+    for (int t = 0; t < numTargets; ++t) {
+      todo[t] = t;
+    }
+    int agent = start, last;
+    double agentDist = 0;
+    while (true) {
+      const double *c = costs + (size_t)agent * numTargets;
+      double base = agentDist - agentDual[agent];
+      double *d = dist.data();
+      int *p = pred.data();
+      const double *v = targetDual.data();
+      int nextAt = -1;
+      double nearest = INF;
+      for (int i = 0; i < numTodo; ++i) {
+        int t = todo[i];
+        double reach = base + sign * c[t] - v[t];
+        if (reach < d[t]) {
+          d[t] = reach;
+          p[t] = agent;
+        }
+        if (d[t] < nearest || (d[t] == nearest && agentOf[t] == -1)) {
+          nearest = d[t];
+          nextAt = i;
+        }
+      }
+      int next = todo[nextAt];
+      todo[nextAt] = todo[--numTodo];
+      if (agentOf[next] == -1) {
+        last = next;
+        break;
+      }
+      reached.push_back(next);
+      agent = agentOf[next];
+      agentDist = nearest;
+    }
+
+    // Shifting the duals by each node's distance short of the free target
+    // keeps the reduced costs non-negative and makes the path tight.
+    double total = dist[last];
+    agentDual[start] += total;
+    for (size_t i = 0; i < reached.size(); ++i) {
+      int t = reached[i];
+      double shift = total - dist[t];
+      agentDual[agentOf[t]] += shift;
+      targetDual[t] -= shift;
+    }
+
+    for (int t = last;;) {
+      int a = pred[t], previous = targetOf[a];
+      agentOf[t] = a;
+      targetOf[a] = t;
+      if (a == start) {
+        break;
+      }
+      t = previous;
+    }
+  }
+};
+
+#endif // RLEMON_LINEAR_ASSIGNMENT_H
@@ -1,148 +1,559 @@
+#include "graph_handle.h"
+#include "parallel.h"
+#include "parallel_preflow.h"
+#include "value_type.h"
 #include <Rcpp.h>
+#include <lemon/boykov_kolmogorov.h>
 #include <lemon/circulation.h>
 #include <lemon/edmonds_karp.h>
+#include <lemon/grid_graph.h>
 #include <lemon/preflow.h>
+#include <memory>
 #include <tuple>
 #include <vector>
 
 using namespace lemon;
 
-//' @rdname lemon_runners
-// [[Rcpp::export]]
-Rcpp::List CirculationRunner(std::vector<int> arcSources,
-                             std::vector<int> arcTargets,
-                             std::vector<int> arcLowerBound,
-                             std::vector<int> arcUpperBound,
-                             std::vector<int> nodeSupplies, int numNodes) {
-  ListDigraph g;
-
-  std::vector<ListDigraph::Node> nodes;
+// Finds a feasible circulation on `h` with bounds and supplies of type
+// `Value`.
+template <typename Value>
+inline Rcpp::List RunCirculation(const DigraphHandle &h,
+                                 const std::vector<double> &arcLowerBound,
+                                 const std::vector<double> &arcUpperBound,
+                                 const std::vector<double> &nodeSupplies) {
+  typedef DigraphHandle::Digraph Digraph;
+  const Digraph &g = h.g;
+  int numNodes = h.nodes.size();
+  int NUM_ARCS = h.arcs.size();
 
+  Digraph::NodeMap<Value> supply(g);
   for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
+    supply[h.nodes[i]] = nodeSupplies[i];
   }
 
-  ListDigraph::NodeMap<int> supply(g);
-  for (int i = 0; i < numNodes; ++i) {
-    supply[nodes[i]] = nodeSupplies[i];
-  }
-
-  std::vector<ListDigraph::Arc> arcs;
-  int NUM_ARCS = arcSources.size();
-
-  ListDigraph::ArcMap<int> upper(g);
-  ListDigraph::ArcMap<int> lower(g);
-
+  Digraph::ArcMap<Value> upper(g);
+  Digraph::ArcMap<Value> lower(g);
   for (int i = 0; i < NUM_ARCS; ++i) {
-    ListDigraph::Arc a =
-        g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    upper[a] = arcUpperBound[i];
-    lower[a] = arcLowerBound[i];
-    arcs.push_back(a);
+    upper[h.arcs[i]] = arcUpperBound[i];
+    lower[h.arcs[i]] = arcLowerBound[i];
   }
 
-  Circulation<ListDigraph> runner(g, lower, upper, supply);
+  Circulation<Digraph, Digraph::ArcMap<Value>, Digraph::ArcMap<Value>,
+              Digraph::NodeMap<Value> >
+      runner(g, lower, upper, supply);
   runner.run();
 
-  std::vector<int> arcFlows;
+  std::vector<Value> arcFlows;
   std::vector<int> barrierNodes;
   for (int i = 0; i < NUM_ARCS; ++i) {
-    arcFlows.push_back(runner.flow(arcs[i]));
+    arcFlows.push_back(runner.flow(h.arcs[i]));
   }
 
   for (int i = 0; i < numNodes; ++i) {
-    if (runner.barrier(nodes[i])) {
+    if (runner.barrier(h.nodes[i])) {
       barrierNodes.push_back(i + 1);
     }
   }
   return Rcpp::List::create(arcFlows, barrierNodes);
 }
 
-//' @rdname lemon_runners
-// [[Rcpp::export]]
-Rcpp::List PreflowRunner(std::vector<int> arcSources,
-                         std::vector<int> arcTargets,
-                         std::vector<int> arcDistances, int sourceNode,
-                         int destinationNode, int numNodes) {
-  ListDigraph g;
+// Runs a maximum flow algorithm (Preflow, EdmondsKarp or BoykovKolmogorov) on
+// `h` and collects the arc flows, the minimum cut and the flow value, with
+// capacities of type `Value`.
+template <template <typename, typename> class MaxFlowAlg, typename Value>
+inline Rcpp::List RunMaxFlow(const DigraphHandle &h,
+                             const std::vector<double> &arcDistances,
+                             int sourceNode, int destinationNode) {
+  typedef DigraphHandle::Digraph Digraph;
+  const Digraph &g = h.g;
+  int numNodes = h.nodes.size();
+  int NUM_ARCS = h.arcs.size();
 
-  std::vector<ListDigraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
+  Digraph::ArcMap<Value> dists(g);
+  for (int i = 0; i < NUM_ARCS; ++i) {
+    dists[h.arcs[i]] = arcDistances[i];
   }
 
-  std::vector<ListDigraph::Arc> arcs;
-  int NUM_ARCS = arcSources.size();
+  MaxFlowAlg<Digraph, Digraph::ArcMap<Value> > runner(
+      g, dists, h.nodes[sourceNode - 1], h.nodes[destinationNode - 1]);
+  runner.run();
 
-  ListDigraph::ArcMap<int> dists(g);
+  Value outVal = runner.flowValue();
+  std::vector<Value> arcFlows;
+  std::vector<int> nodeCuts;
+  for (int i = 0; i < NUM_ARCS; ++i) {
+    arcFlows.push_back(runner.flow(h.arcs[i]));
+  }
+
+  for (int i = 0; i < numNodes; ++i) {
+    nodeCuts.push_back(runner.minCut(h.nodes[i]));
+  }
+  return Rcpp::List::create(arcFlows, nodeCuts, outVal);
+}
+
+// Finds the maximum flow value between each pair of sourceNodes[i] and
+// destinationNodes[i] on `h`, with capacities of type `Value`. Pairs are
+// spread over `numThreads` threads; each worker keeps one Preflow whose
+// flow map, excess map and elevator are reused from pair to pair, and only
+// runs its first phase, which already gives the flow value and the minimum
+// cut. The cut matrix, pairs x nodes, is only filled when `cuts` is true.
+template <typename Value>
+inline Rcpp::List RunPreflowBatch(const DigraphHandle &h,
+                                  const std::vector<double> &arcDistances,
+                                  const std::vector<int> &sourceNodes,
+                                  const std::vector<int> &destinationNodes,
+                                  bool cuts, int numThreads) {
+  typedef DigraphHandle::Digraph Digraph;
+  typedef Preflow<Digraph, Digraph::ArcMap<Value> > PreflowSolver;
+  const Digraph &g = h.g;
+  int numNodes = h.nodes.size();
+  int NUM_ARCS = h.arcs.size();
+  int numPairs = sourceNodes.size();
+  for (int i = 0; i < numPairs; ++i) {
+    if (sourceNodes[i] == destinationNodes[i]) {
+      Rcpp::stop("The source and destination nodes must be different.");
+    }
+  }
 
+  Digraph::ArcMap<Value> dists(g);
   for (int i = 0; i < NUM_ARCS; ++i) {
-    ListDigraph::Arc a =
-        g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    dists[a] = arcDistances[i];
+    dists[h.arcs[i]] = arcDistances[i];
+  }
 
-    arcs.push_back(a);
+  int numWorkers = NumWorkers(numThreads, numPairs);
+  std::vector<std::unique_ptr<PreflowSolver> > workers(numWorkers);
+  for (int w = 0; w < numWorkers && numPairs > 0; ++w) {
+    workers[w].reset(new PreflowSolver(g, dists,
+                                       h.nodes[sourceNodes[0] - 1],
+                                       h.nodes[destinationNodes[0] - 1]));
   }
 
-  Preflow<ListDigraph> runner(g, dists, nodes[sourceNode - 1],
-                              nodes[destinationNode - 1]);
-  runner.run();
+  std::vector<Value> values(numPairs);
+  // Column-major pairs x nodes, as R stores matrices.
+  std::vector<int> nodeCuts(cuts ? (size_t)numPairs * numNodes : 0);
+  ParallelFor(numPairs, numWorkers, [&](int task, int worker) {
+    PreflowSolver &alg = *workers[worker];
+    alg.source(h.nodes[sourceNodes[task] - 1]);
+    alg.target(h.nodes[destinationNodes[task] - 1]);
+    alg.runMinCut();
+    values[task] = alg.flowValue();
+    if (cuts) {
+      for (int i = 0; i < numNodes; ++i) {
+        nodeCuts[(size_t)i * numPairs + task] = alg.minCut(h.nodes[i]);
+      }
+    }
+  });
+
+  if (!cuts) {
+    return Rcpp::List::create(values, R_NilValue);
+  }
+  Rcpp::IntegerMatrix cutMatrix(numPairs, numNodes);
+  std::copy(nodeCuts.begin(), nodeCuts.end(), cutMatrix.begin());
+  return Rcpp::List::create(values, cutMatrix);
+}
+
+// Runs ParallelPreflow on `h` with capacities of type `Value`, collecting
+// the same outputs as RunMaxFlow.
+template <typename Value>
+inline Rcpp::List RunParallelPreflow(const DigraphHandle &h,
+                                     const std::vector<double> &arcDistances,
+                                     int sourceNode, int destinationNode,
+                                     int numThreads) {
+  typedef DigraphHandle::Digraph Digraph;
+  int numNodes = h.nodes.size();
+  int NUM_ARCS = h.arcs.size();
+  if (sourceNode == destinationNode) {
+    Rcpp::stop("The source and destination nodes must be different.");
+  }
 
-  int outVal = runner.flowValue();
-  std::vector<int> arcFlows;
+  std::vector<Value> capacities(NUM_ARCS);
+  for (int i = 0; i < NUM_ARCS; ++i) {
+    capacities[Digraph::id(h.arcs[i])] = arcDistances[i];
+  }
+
+  ParallelPreflow<Value> runner(h, capacities, numThreads);
+  runner.run(sourceNode - 1, destinationNode - 1);
+
+  std::vector<Value> arcFlows;
   std::vector<int> nodeCuts;
   for (int i = 0; i < NUM_ARCS; ++i) {
-    arcFlows.push_back(runner.flow(arcs[i]));
+    arcFlows.push_back(runner.flow(Digraph::id(h.arcs[i])));
   }
 
   for (int i = 0; i < numNodes; ++i) {
-    nodeCuts.push_back(runner.minCut(nodes[i]));
+    nodeCuts.push_back(runner.minCut(i));
   }
-  return Rcpp::List::create(arcFlows, nodeCuts, outVal);
+  return Rcpp::List::create(arcFlows, nodeCuts, runner.value());
+}
+
+// A Preflow solver kept in C++ memory between calls, so that after the
+// capacities change the maximum flow can be found again starting from the
+// previous flow with Preflow::init(flowMap), instead of from zero. That flow
+// stays feasible as long as no capacity drops below the flow on its arc;
+// `warm` records whether this still holds. Capacities are always double, as
+// later changes may not be whole numbers.
+struct MaxFlowSolver {
+  typedef DigraphHandle::Digraph Digraph;
+  typedef Preflow<Digraph, Digraph::ArcMap<double> > PreflowSolver;
+
+  DigraphHandle h;
+  std::unique_ptr<Digraph::ArcMap<double> > capacities;
+  std::unique_ptr<PreflowSolver> preflow;
+  bool solved = false;
+  bool warm = false;
+};
+
+inline MaxFlowSolver &GetMaxFlowSolver(SEXP solver) {
+  Rcpp::XPtr<MaxFlowSolver> ptr(solver);
+  if (ptr.get() == NULL) {
+    Rcpp::stop("The max flow solver is no longer valid (was it saved and "
+               "reloaded?); rebuild it with BuildMaxFlowSolver().");
+  }
+  return *ptr;
+}
+
+// Finds the minimum cut of a numRows x numCols pixel grid with
+// BoykovKolmogorov on a GridGraph, with values of type `Value`. The source
+// and destination capacities give each pixel's terminal arcs, and the
+// horizontal and vertical capacities the arcs, in both directions, between
+// neighbouring pixels. All of them are column-major rasters, as R stores
+// matrices.
+template <typename Value>
+inline Rcpp::List RunGridMaxFlow(const std::vector<double> &sourceCapacities,
+                                 const std::vector<double> &destCapacities,
+                                 const std::vector<double> &horizontalCapacities,
+                                 const std::vector<double> &verticalCapacities,
+                                 int numRows, int numCols) {
+  // Rows of the raster are GridGraph rows, so GridGraph's up() arcs point
+  // to the next row.
+  GridGraph g(numCols, numRows);
+  GridGraph::NodeMap<Value> source(g), dest(g);
+  GridGraph::ArcMap<Value> capacity(g);
+  for (int c = 0; c < numCols; ++c) {
+    for (int r = 0; r < numRows; ++r) {
+      GridGraph::Node node = g(c, r);
+      source[node] = sourceCapacities[r + c * numRows];
+      dest[node] = destCapacities[r + c * numRows];
+      if (c + 1 < numCols) {
+        Value cap = horizontalCapacities[r + c * numRows];
+        capacity[g.right(node)] = cap;
+        capacity[g.left(g(c + 1, r))] = cap;
+      }
+      if (r + 1 < numRows) {
+        Value cap = verticalCapacities[r + c * (numRows - 1)];
+        capacity[g.up(node)] = cap;
+        capacity[g.down(g(c, r + 1))] = cap;
+      }
+    }
+  }
+
+  BoykovKolmogorov<GridGraph, GridGraph::ArcMap<Value> > runner(g, capacity,
+                                                                source, dest);
+  runner.run();
+
+  std::vector<int> nodeCuts(numRows * numCols);
+  for (int c = 0; c < numCols; ++c) {
+    for (int r = 0; r < numRows; ++r) {
+      nodeCuts[r + c * numRows] = runner.minCut(g(c, r));
+    }
+  }
+  Value outVal = runner.flowValue();
+  return Rcpp::List::create(nodeCuts, outVal);
+}
+
+// Preflow, EdmondsKarp and BoykovKolmogorov take a traits class as their
+// third template argument; these aliases let RunMaxFlow instantiate any of
+// them.
+template <typename GR, typename CAP> using PreflowAlg = Preflow<GR, CAP>;
+template <typename GR, typename CAP>
+using EdmondsKarpAlg = EdmondsKarp<GR, CAP>;
+template <typename GR, typename CAP>
+using BoykovKolmogorovAlg = BoykovKolmogorov<GR, CAP>;
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List CirculationRunner(std::vector<int> arcSources,
+                             std::vector<int> arcTargets,
+                             std::vector<double> arcLowerBound,
+                             std::vector<double> arcUpperBound,
+                             std::vector<double> nodeSupplies, int numNodes) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  if (IsIntegral(arcLowerBound) && IsIntegral(arcUpperBound) &&
+      IsIntegral(nodeSupplies)) {
+    return RunCirculation<int>(h, arcLowerBound, arcUpperBound, nodeSupplies);
+  }
+  return RunCirculation<double>(h, arcLowerBound, arcUpperBound,
+                                nodeSupplies);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List CirculationGraphRunner(SEXP graph,
+                                  std::vector<double> arcLowerBound,
+                                  std::vector<double> arcUpperBound,
+                                  std::vector<double> nodeSupplies) {
+  const DigraphHandle &h = GetDigraph(graph);
+  if (IsIntegral(arcLowerBound) && IsIntegral(arcUpperBound) &&
+      IsIntegral(nodeSupplies)) {
+    return RunCirculation<int>(h, arcLowerBound, arcUpperBound, nodeSupplies);
+  }
+  return RunCirculation<double>(h, arcLowerBound, arcUpperBound,
+                                nodeSupplies);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List PreflowRunner(std::vector<int> arcSources,
+                         std::vector<int> arcTargets,
+                         std::vector<double> arcDistances, int sourceNode,
+                         int destinationNode, int numNodes) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  if (IsIntegral(arcDistances)) {
+    return RunMaxFlow<PreflowAlg, int>(h, arcDistances, sourceNode,
+                                       destinationNode);
+  }
+  return RunMaxFlow<PreflowAlg, double>(h, arcDistances, sourceNode,
+                                        destinationNode);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List PreflowGraphRunner(SEXP graph, std::vector<double> arcDistances,
+                              int sourceNode, int destinationNode) {
+  const DigraphHandle &h = GetDigraph(graph);
+  if (IsIntegral(arcDistances)) {
+    return RunMaxFlow<PreflowAlg, int>(h, arcDistances, sourceNode,
+                                       destinationNode);
+  }
+  return RunMaxFlow<PreflowAlg, double>(h, arcDistances, sourceNode,
+                                        destinationNode);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List PreflowBatchRunner(std::vector<int> arcSources,
+                              std::vector<int> arcTargets,
+                              std::vector<double> arcDistances,
+                              std::vector<int> sourceNodes,
+                              std::vector<int> destinationNodes, int numNodes,
+                              bool cuts, int numThreads) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  if (IsIntegral(arcDistances)) {
+    return RunPreflowBatch<int>(h, arcDistances, sourceNodes,
+                                destinationNodes, cuts, numThreads);
+  }
+  return RunPreflowBatch<double>(h, arcDistances, sourceNodes,
+                                 destinationNodes, cuts, numThreads);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List PreflowBatchGraphRunner(SEXP graph,
+                                   std::vector<double> arcDistances,
+                                   std::vector<int> sourceNodes,
+                                   std::vector<int> destinationNodes,
+                                   bool cuts, int numThreads) {
+  const DigraphHandle &h = GetDigraph(graph);
+  if (IsIntegral(arcDistances)) {
+    return RunPreflowBatch<int>(h, arcDistances, sourceNodes,
+                                destinationNodes, cuts, numThreads);
+  }
+  return RunPreflowBatch<double>(h, arcDistances, sourceNodes,
+                                 destinationNodes, cuts, numThreads);
 }
 
 //' @rdname lemon_runners
 // [[Rcpp::export]]
 Rcpp::List EdmondsKarpRunner(std::vector<int> arcSources,
                              std::vector<int> arcTargets,
-                             std::vector<int> arcDistances, int sourceNode,
+                             std::vector<double> arcDistances, int sourceNode,
                              int destinationNode, int numNodes) {
-  ListDigraph g;
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  if (IsIntegral(arcDistances)) {
+    return RunMaxFlow<EdmondsKarpAlg, int>(h, arcDistances, sourceNode,
+                                           destinationNode);
+  }
+  return RunMaxFlow<EdmondsKarpAlg, double>(h, arcDistances, sourceNode,
+                                            destinationNode);
+}
 
-  std::vector<ListDigraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List EdmondsKarpGraphRunner(SEXP graph, std::vector<double> arcDistances,
+                                  int sourceNode, int destinationNode) {
+  const DigraphHandle &h = GetDigraph(graph);
+  if (IsIntegral(arcDistances)) {
+    return RunMaxFlow<EdmondsKarpAlg, int>(h, arcDistances, sourceNode,
+                                           destinationNode);
   }
+  return RunMaxFlow<EdmondsKarpAlg, double>(h, arcDistances, sourceNode,
+                                            destinationNode);
+}
 
-  std::vector<ListDigraph::Arc> arcs;
-  int NUM_ARCS = arcSources.size();
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List ParallelPreflowRunner(std::vector<int> arcSources,
+                                 std::vector<int> arcTargets,
+                                 std::vector<double> arcDistances,
+                                 int sourceNode, int destinationNode,
+                                 int numNodes, int numThreads) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  if (IsIntegral(arcDistances)) {
+    return RunParallelPreflow<int>(h, arcDistances, sourceNode,
+                                   destinationNode, numThreads);
+  }
+  return RunParallelPreflow<double>(h, arcDistances, sourceNode,
+                                    destinationNode, numThreads);
+}
 
-  ListDigraph::ArcMap<int> dists(g);
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List ParallelPreflowGraphRunner(SEXP graph,
+                                      std::vector<double> arcDistances,
+                                      int sourceNode, int destinationNode,
+                                      int numThreads) {
+  const DigraphHandle &h = GetDigraph(graph);
+  if (IsIntegral(arcDistances)) {
+    return RunParallelPreflow<int>(h, arcDistances, sourceNode,
+                                   destinationNode, numThreads);
+  }
+  return RunParallelPreflow<double>(h, arcDistances, sourceNode,
+                                    destinationNode, numThreads);
+}
 
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    ListDigraph::Arc a =
-        g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    dists[a] = arcDistances[i];
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List BoykovKolmogorovRunner(std::vector<int> arcSources,
+                                  std::vector<int> arcTargets,
+                                  std::vector<double> arcDistances,
+                                  int sourceNode, int destinationNode,
+                                  int numNodes) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  if (IsIntegral(arcDistances)) {
+    return RunMaxFlow<BoykovKolmogorovAlg, int>(h, arcDistances, sourceNode,
+                                                destinationNode);
+  }
+  return RunMaxFlow<BoykovKolmogorovAlg, double>(h, arcDistances, sourceNode,
+                                                 destinationNode);
+}
 
-    arcs.push_back(a);
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List BoykovKolmogorovGraphRunner(SEXP graph,
+                                       std::vector<double> arcDistances,
+                                       int sourceNode, int destinationNode) {
+  const DigraphHandle &h = GetDigraph(graph);
+  if (IsIntegral(arcDistances)) {
+    return RunMaxFlow<BoykovKolmogorovAlg, int>(h, arcDistances, sourceNode,
+                                                destinationNode);
   }
+  return RunMaxFlow<BoykovKolmogorovAlg, double>(h, arcDistances, sourceNode,
+                                                 destinationNode);
+}
 
-  EdmondsKarp<ListDigraph> runner(g, dists, nodes[sourceNode - 1],
-                                  nodes[destinationNode - 1]);
-  runner.run();
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List GridBoykovKolmogorovRunner(std::vector<double> sourceCapacities,
+                                      std::vector<double> destCapacities,
+                                      std::vector<double> horizontalCapacities,
+                                      std::vector<double> verticalCapacities,
+                                      int numRows, int numCols) {
+  if (IsIntegral(sourceCapacities) && IsIntegral(destCapacities) &&
+      IsIntegral(horizontalCapacities) && IsIntegral(verticalCapacities)) {
+    return RunGridMaxFlow<int>(sourceCapacities, destCapacities,
+                               horizontalCapacities, verticalCapacities,
+                               numRows, numCols);
+  }
+  return RunGridMaxFlow<double>(sourceCapacities, destCapacities,
+                                horizontalCapacities, verticalCapacities,
+                                numRows, numCols);
+}
 
-  int outVal = runner.flowValue();
-  std::vector<int> arcFlows;
-  std::vector<int> nodeCuts;
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    arcFlows.push_back(runner.flow(arcs[i]));
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+SEXP PreflowSolverRunner(std::vector<int> arcSources,
+                         std::vector<int> arcTargets,
+                         std::vector<double> arcCapacities, int sourceNode,
+                         int destinationNode, int numNodes) {
+  if (sourceNode == destinationNode) {
+    Rcpp::stop("The source and destination nodes must be different.");
+  }
+  Rcpp::XPtr<MaxFlowSolver> ptr(new MaxFlowSolver(), true);
+  MaxFlowSolver &mf = *ptr;
+  BuildDigraph(mf.h, arcSources, arcTargets, numNodes);
+  mf.capacities.reset(new MaxFlowSolver::Digraph::ArcMap<double>(mf.h.g));
+  for (size_t i = 0; i < mf.h.arcs.size(); ++i) {
+    (*mf.capacities)[mf.h.arcs[i]] = arcCapacities[i];
   }
+  mf.preflow.reset(new MaxFlowSolver::PreflowSolver(
+      mf.h.g, *mf.capacities, mf.h.nodes[sourceNode - 1],
+      mf.h.nodes[destinationNode - 1]));
+  return ptr;
+}
 
-  for (int i = 0; i < numNodes; ++i) {
-    nodeCuts.push_back(runner.minCut(nodes[i]));
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+void PreflowSolverUpdateRunner(SEXP solver, std::vector<int> arcs,
+                               std::vector<double> capacityDeltas) {
+  MaxFlowSolver &mf = GetMaxFlowSolver(solver);
+  int NUM_ARCS = mf.h.arcs.size();
+  for (size_t i = 0; i < arcs.size(); ++i) {
+    if (arcs[i] < 1 || arcs[i] > NUM_ARCS) {
+      Rcpp::stop("Arc index given is out of range for the solver.");
+    }
   }
-  return Rcpp::List::create(arcFlows, nodeCuts, outVal);
+  // An arc may be changed more than once, so only the final capacities are
+  // checked; the changes are undone if any of them is negative.
+  DigraphHandle::Digraph::ArcMap<double> &capacities = *mf.capacities;
+  std::vector<double> previous(arcs.size());
+  for (size_t i = 0; i < arcs.size(); ++i) {
+    previous[i] = capacities[mf.h.arcs[arcs[i] - 1]];
+    capacities[mf.h.arcs[arcs[i] - 1]] += capacityDeltas[i];
+  }
+  for (size_t i = 0; i < arcs.size(); ++i) {
+    if (capacities[mf.h.arcs[arcs[i] - 1]] < 0) {
+      for (size_t j = arcs.size(); j-- > 0;) {
+        capacities[mf.h.arcs[arcs[j] - 1]] = previous[j];
+      }
+      Rcpp::stop("Arc capacities must not become negative.");
+    }
+  }
+  for (size_t i = 0; i < arcs.size(); ++i) {
+    DigraphHandle::Digraph::Arc arc = mf.h.arcs[arcs[i] - 1];
+    if (mf.solved && capacities[arc] < mf.preflow->flow(arc)) {
+      mf.warm = false;
+    }
+  }
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List PreflowSolverSolveRunner(SEXP solver) {
+  MaxFlowSolver &mf = GetMaxFlowSolver(solver);
+  MaxFlowSolver::PreflowSolver &preflow = *mf.preflow;
+  if (mf.warm && preflow.init(preflow.flowMap())) {
+    preflow.startFirstPhase();
+    preflow.startSecondPhase();
+  } else {
+    preflow.run();
+  }
+  mf.solved = true;
+  mf.warm = true;
+
+  const DigraphHandle &h = mf.h;
+  std::vector<double> arcFlows;
+  std::vector<int> nodeCuts;
+  for (size_t i = 0; i < h.arcs.size(); ++i) {
+    arcFlows.push_back(preflow.flow(h.arcs[i]));
+  }
+  for (size_t i = 0; i < h.nodes.size(); ++i) {
+    nodeCuts.push_back(preflow.minCut(h.nodes[i]));
+  }
+  return Rcpp::List::create(arcFlows, nodeCuts, preflow.flowValue());
 }
@@ -1,7 +1,12 @@
+#include "hopcroft_karp.h"
+#include "linear_assignment.h"
+#include "lemon/connectivity.h"
 #include "lemon/fractional_matching.h"
 #include "lemon/list_graph.h"
 #include "lemon/matching.h"
+#include "value_type.h"
 #include <Rcpp.h>
+#include <string>
 #include <vector>
 
 typedef int Value;
@@ -19,32 +24,36 @@ template <typename ValueType> using EdgeMap = ListGraph::EdgeMap<ValueType>;
 
 template <typename ValueType> using NodeMap = ListGraph::NodeMap<ValueType>;
 
-//' @rdname lemon_runners
-// [[Rcpp::export]]
-Rcpp::List MaximumWeightPerfectMatchingRunner(std::vector<int> arcSources,
-                                              std::vector<int> arcTargets,
-                                              std::vector<int> arcWeights,
-                                              int numNodes) {
-  ListGraph g;
+// Builds the undirected graph `g` with nodes 1 to numNodes and the edges
+// arcSources[i] - arcTargets[i], kept in input order in `arcs`, with weights
+// arcWeights[i] in `dists`.
+template <typename Value>
+inline void BuildWeightedGraph(const std::vector<int> &arcSources,
+                               const std::vector<int> &arcTargets,
+                               const std::vector<double> &arcWeights,
+                               int numNodes, ListGraph &g,
+                               EdgeMap<Value> &dists, std::vector<Edge> &arcs) {
   std::vector<Node> nodes;
-  EdgeMap<Cost> dists(g);
   for (int i = 0; i < numNodes; ++i) {
     Node n = g.addNode();
     nodes.push_back(n);
   }
-
-  std::vector<Edge> arcs;
   int NUM_ARCS = arcSources.size();
-
   for (int i = 0; i < NUM_ARCS; ++i) {
     Edge a = g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
     dists[a] = arcWeights[i];
     arcs.push_back(a);
   }
-  auto test = MaxWeightedPerfectMatching<ListGraph, EdgeMap<Cost> >(g, dists);
+}
+
+// The end nodes (from 1) of the edges of `arcs`, in input order, that are in
+// the matching found by `test` on `g`.
+template <typename MatchingAlg>
+inline std::vector<std::vector<int> >
+MatchedEdges(const ListGraph &g, const std::vector<Edge> &arcs,
+             const MatchingAlg &test) {
   std::vector<std::vector<int> > arcs_out;
-  test.run();
-  for (int i = 0; i < NUM_ARCS; i++) {
+  for (size_t i = 0; i < arcs.size(); i++) {
     if (test.matching(arcs[i])) {
       std::vector<int> arc;
       arc.push_back(g.id(g.u(arcs[i])) + 1);
@@ -52,117 +61,126 @@ Rcpp::List MaximumWeightPerfectMatchingRunner(std::vector<int> arcSources,
       arcs_out.push_back(arc);
     }
   }
-  return Rcpp::List::create(test.matchingWeight(), arcs_out);
+  return arcs_out;
 }
 
-//' @rdname lemon_runners
-// [[Rcpp::export]]
-Rcpp::List MaximumWeightFractionalPerfectMatchingRunner(
-    std::vector<int> arcSources, std::vector<int> arcTargets,
-    std::vector<int> arcWeights, int numNodes) {
+// Runs a weighted matching algorithm (MaxWeightedMatching,
+// MaxWeightedPerfectMatching or their fractional versions) with edge weights
+// of type `Value`, and collects the matching weight and the matched edges.
+template <template <typename, typename> class MatchingAlg, typename Value>
+inline Rcpp::List RunWeightedMatching(const std::vector<int> &arcSources,
+                                      const std::vector<int> &arcTargets,
+                                      const std::vector<double> &arcWeights,
+                                      int numNodes) {
   ListGraph g;
-  std::vector<Node> nodes;
-  EdgeMap<Cost> dists(g);
-  for (int i = 0; i < numNodes; ++i) {
-    Node n = g.addNode();
-    nodes.push_back(n);
-  }
+  EdgeMap<Value> dists(g);
+  std::vector<Edge> arcs;
+  BuildWeightedGraph(arcSources, arcTargets, arcWeights, numNodes, g, dists,
+                     arcs);
+  MatchingAlg<ListGraph, EdgeMap<Value> > test(g, dists);
+  test.run();
+  return Rcpp::List::create(test.matchingWeight(),
+                            MatchedEdges(g, arcs, test));
+}
 
+// Runs MaxWeightedMatching with edge weights of type `Value`, from the
+// starting matching and dual solution named by `init`: "Fractional" (the
+// default of MaxWeightedMatching::run()), "Greedy" or "Empty". Collects the
+// matching weight, the matched edges, and the numbers of augmentations and
+// of steps the blossom algorithm took from there.
+template <typename Value>
+inline Rcpp::List RunMaxWeightedMatching(const std::vector<int> &arcSources,
+                                         const std::vector<int> &arcTargets,
+                                         const std::vector<double> &arcWeights,
+                                         int numNodes,
+                                         const std::string &init) {
+  if (init != "Fractional" && init != "Greedy" && init != "Empty") {
+    Rcpp::stop("Invalid init.");
+  }
+  ListGraph g;
+  EdgeMap<Value> dists(g);
   std::vector<Edge> arcs;
-  int NUM_ARCS = arcSources.size();
+  BuildWeightedGraph(arcSources, arcTargets, arcWeights, numNodes, g, dists,
+                     arcs);
+  MaxWeightedMatching<ListGraph, EdgeMap<Value> > test(g, dists);
+  if (init == "Fractional") {
+    test.fractionalInit();
+  } else if (init == "Greedy") {
+    test.greedyInit();
+  } else {
+    test.init();
+  }
+  test.start();
+  std::vector<int> counts;
+  counts.push_back(test.augmentNum());
+  counts.push_back(test.stepNum());
+  return Rcpp::List::create(test.matchingWeight(), MatchedEdges(g, arcs, test),
+                            counts);
+}
 
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    Edge a = g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    dists[a] = arcWeights[i];
-    arcs.push_back(a);
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List MaximumWeightPerfectMatchingRunner(std::vector<int> arcSources,
+                                              std::vector<int> arcTargets,
+                                              std::vector<double> arcWeights,
+                                              int numNodes) {
+  if (IsIntegral(arcWeights)) {
+    return RunWeightedMatching<MaxWeightedPerfectMatching, int>(
+        arcSources, arcTargets, arcWeights, numNodes);
   }
-  auto test =
-      MaxWeightedPerfectFractionalMatching<ListGraph, EdgeMap<Cost> >(g, dists);
-  std::vector<std::vector<int> > arcs_out;
-  test.run();
-  for (int i = 0; i < NUM_ARCS; i++) {
-    if (test.matching(arcs[i])) {
-      std::vector<int> arc;
-      arc.push_back(g.id(g.u(arcs[i])) + 1);
-      arc.push_back(g.id(g.v(arcs[i])) + 1);
-      arcs_out.push_back(arc);
-    }
+  return RunWeightedMatching<MaxWeightedPerfectMatching, double>(
+      arcSources, arcTargets, arcWeights, numNodes);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List MaximumWeightFractionalPerfectMatchingRunner(
+    std::vector<int> arcSources, std::vector<int> arcTargets,
+    std::vector<double> arcWeights, int numNodes) {
+  if (IsIntegral(arcWeights)) {
+    return RunWeightedMatching<MaxWeightedPerfectFractionalMatching, int>(
+        arcSources, arcTargets, arcWeights, numNodes);
   }
-  return Rcpp::List::create(test.matchingWeight(), arcs_out);
+  return RunWeightedMatching<MaxWeightedPerfectFractionalMatching, double>(
+      arcSources, arcTargets, arcWeights, numNodes);
 }
 
 //' @rdname lemon_runners
 // [[Rcpp::export]]
 Rcpp::List MaximumWeightFractionalMatchingRunner(std::vector<int> arcSources,
                                                  std::vector<int> arcTargets,
-                                                 std::vector<int> arcWeights,
+                                                 std::vector<double> arcWeights,
                                                  int numNodes) {
-  ListGraph g;
-  std::vector<Node> nodes;
-  EdgeMap<Cost> dists(g);
-  for (int i = 0; i < numNodes; ++i) {
-    Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  std::vector<Edge> arcs;
-
-  int NUM_ARCS = arcSources.size();
-
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    Edge a = g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    dists[a] = arcWeights[i];
-    arcs.push_back(a);
-  }
-  auto test =
-      MaxWeightedFractionalMatching<ListGraph, EdgeMap<Cost> >(g, dists);
-  std::vector<std::vector<int> > arcs_out;
-  test.run();
-  for (int i = 0; i < NUM_ARCS; i++) {
-    if (test.matching(arcs[i])) {
-      std::vector<int> arc;
-      arc.push_back(g.id(g.u(arcs[i])) + 1);
-      arc.push_back(g.id(g.v(arcs[i])) + 1);
-      arcs_out.push_back(arc);
-    }
+  if (IsIntegral(arcWeights)) {
+    return RunWeightedMatching<MaxWeightedFractionalMatching, int>(
+        arcSources, arcTargets, arcWeights, numNodes);
   }
-  return Rcpp::List::create(test.matchingWeight(), arcs_out);
+  return RunWeightedMatching<MaxWeightedFractionalMatching, double>(
+      arcSources, arcTargets, arcWeights, numNodes);
 }
 
 //' @rdname lemon_runners
 // [[Rcpp::export]]
 Rcpp::List MaximumWeightMatchingRunner(std::vector<int> arcSources,
                                        std::vector<int> arcTargets,
-                                       std::vector<int> arcWeights,
-                                       int numNodes) {
-  ListGraph g;
-  std::vector<Node> nodes;
-  EdgeMap<Cost> dists(g);
-  for (int i = 0; i < numNodes; ++i) {
-    Node n = g.addNode();
-    nodes.push_back(n);
+                                       std::vector<double> arcWeights,
+                                       int numNodes,
+                                       std::string init = "Fractional") {
+  if (IsIntegral(arcWeights)) {
+    return RunMaxWeightedMatching<int>(arcSources, arcTargets, arcWeights,
+                                       numNodes, init);
   }
+  return RunMaxWeightedMatching<double>(arcSources, arcTargets, arcWeights,
+                                        numNodes, init);
+}
 
-  std::vector<Edge> arcs;
-
-  int NUM_ARCS = arcSources.size();
-
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    Edge a = g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    dists[a] = arcWeights[i];
-    arcs.push_back(a);
-  }
-  auto test = MaxWeightedMatching<ListGraph>(g, dists);
-  std::vector<std::vector<int> > arcs_out;
-  test.run();
-  for (int i = 0; i < NUM_ARCS; i++) {
-    if (test.matching(arcs[i])) {
-      std::vector<int> arc;
-      arc.push_back(g.id(g.u(arcs[i])) + 1);
-      arc.push_back(g.id(g.v(arcs[i])) + 1);
-      arcs_out.push_back(arc);
-    }
-  }
-  return Rcpp::List::create(test.matchingWeight(), arcs_out);
+// Collects the size and the matched edges, in input order, of a cardinality
+// matching algorithm which has been run on `g`.
+template <typename MatchingAlg>
+inline Rcpp::List MatchingResult(const ListGraph &g,
+                                 const std::vector<Edge> &arcs,
+                                 const MatchingAlg &test) {
+  return Rcpp::List::create(test.matchingSize(), MatchedEdges(g, arcs, test));
 }
 
 //' @rdname lemon_runners
@@ -190,19 +208,18 @@ Rcpp::List MaximumCardinalityMatchingRunner(std::vector<int> arcSources,
     Edge a = g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
     arcs.push_back(a);
   }
+  // Bipartite graphs are matched by Hopcroft-Karp, and others by Edmonds'
+  // blossom algorithm.
+  NodeMap<bool> red(g);
+  if (bipartitePartitions(g, red)) {
+    HopcroftKarp<ListGraph, NodeMap<bool> > test(g, red);
+    test.run();
+    return MatchingResult(g, arcs, test);
+  }
   ListGraph::EdgeMap<int> map(g);
   auto test = MaxMatching<ListGraph>(g);
   test.run();
-  std::vector<std::vector<int> > arcs_out;
-  for (int i = 0; i < NUM_ARCS; i++) {
-    if (test.matching(arcs[i])) {
-      std::vector<int> arc;
-      arc.push_back(g.id(g.u(arcs[i])) + 1);
-      arc.push_back(g.id(g.v(arcs[i])) + 1);
-      arcs_out.push_back(arc);
-    }
-  }
-  return Rcpp::List::create(test.matchingSize(), arcs_out);
+  return MatchingResult(g, arcs, test);
 }
 
 //' @rdname lemon_runners
@@ -232,14 +249,39 @@ Rcpp::List MaximumCardinalityFractionalMatchingRunner(
   ListGraph::EdgeMap<int> map(g);
   auto test = MaxFractionalMatching<ListGraph>(g);
   test.run();
-  std::vector<std::vector<int> > arcs_out;
-  for (int i = 0; i < NUM_ARCS; i++) {
-    if (test.matching(arcs[i])) {
-      std::vector<int> arc;
-      arc.push_back(g.id(g.u(arcs[i])) + 1);
-      arc.push_back(g.id(g.v(arcs[i])) + 1);
-      arcs_out.push_back(arc);
+  return MatchingResult(g, arcs, test);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List HungarianRunner(Rcpp::NumericMatrix costs, bool maximize) {
+  int numRows = costs.nrow(), numCols = costs.ncol();
+  // The solver wants each agent's costs contiguous. R stores the matrix by
+  // column, so the columns are the agents when there are no more of them
+  // than rows, and the matrix is read in place; otherwise the rows are,
+  // from a transposed copy.
+  std::vector<int> columnOf(numRows, NA_INTEGER);
+  double cost;
+  if (numCols <= numRows) {
+    LinearAssignment solver(costs.begin(), numCols, numRows, maximize);
+    solver.run();
+    for (int c = 0; c < numCols; ++c) {
+      columnOf[solver.target(c)] = c + 1;
+    }
+    cost = solver.totalCost();
+  } else {
+    std::vector<double> transposed((size_t)numRows * numCols);
+    for (int c = 0; c < numCols; ++c) {
+      for (int r = 0; r < numRows; ++r) {
+        transposed[(size_t)r * numCols + c] = costs[r + (size_t)c * numRows];
+      }
+    }
+    LinearAssignment solver(transposed.data(), numRows, numCols, maximize);
+    solver.run();
+    for (int r = 0; r < numRows; ++r) {
+      columnOf[r] = solver.target(r) + 1;
     }
+    cost = solver.totalCost();
   }
-  return Rcpp::List::create(test.matchingSize(), arcs_out);
+  return Rcpp::List::create(cost, columnOf);
 }
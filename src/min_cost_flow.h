@@ -1,262 +1,444 @@
+#include "graph_handle.h"
 #include "lemon/list_graph.h"
+#include "value_type.h"
 #include <Rcpp.h>
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cmath>
 #include <lemon/capacity_scaling.h>
 #include <lemon/cost_scaling.h>
 #include <lemon/cycle_canceling.h>
 #include <lemon/network_simplex.h>
+#include <map>
+#include <memory>
+#include <string>
 #include <tuple>
 #include <vector>
 
 using namespace lemon;
 
-//' @rdname lemon_runners
-// [[Rcpp::export]]
-Rcpp::List CycleCancellingRunner(std::vector<int> arcSources,
-                                 std::vector<int> arcTargets,
-                                 std::vector<int> arcCapacities,
-                                 std::vector<int> arcCosts,
-                                 std::vector<int> nodeSupplies, int numNodes) {
-  ListDigraph g;
-  std::vector<ListDigraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  std::vector<ListDigraph::Arc> arcs;
-  int NUM_ARCS = arcSources.size();
-
-  ListDigraph::ArcMap<int> costs(g);
-  ListDigraph::ArcMap<int> capacities(g);
-  ListDigraph::NodeMap<int> supplies(g);
-
-  for (int i = 0; i < numNodes; ++i) {
-    supplies[nodes[i]] = nodeSupplies[i];
-  }
-
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    ListDigraph::Arc a =
-        g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    costs[a] = arcCosts[i];
-    capacities[a] = arcCapacities[i];
-    arcs.push_back(a);
-  }
+// Packs the solution found by `runner`, an instantiation of NetworkSimplex,
+// CostScaling, CapacityScaling or CycleCanceling, into the list returned to
+// R. The total cost is summed as a double, which the Cost type may not hold.
+template <typename MCF>
+inline Rcpp::List MinCostFlowResult(const DigraphHandle &h, const MCF &runner,
+                                    typename MCF::ProblemType feasibility) {
+  typedef typename MCF::Value Value;
+  typedef typename MCF::Cost Cost;
+  int numNodes = h.nodes.size();
+  int NUM_ARCS = h.arcs.size();
 
-  CycleCanceling<ListDigraph, int, int> runner(g);
-  runner.upperMap(capacities);
-  runner.costMap(costs);
-  runner.supplyMap(supplies);
-  CycleCanceling<ListDigraph, int, int>::ProblemType feasibility = runner.run();
   std::string feasibility_type = "";
-  if (feasibility ==
-      CycleCanceling<ListDigraph, int, int>::ProblemType::INFEASIBLE) {
+  if (feasibility == MCF::INFEASIBLE) {
     feasibility_type = "INFEASIBLE";
-  } else if (feasibility ==
-             CycleCanceling<ListDigraph, int, int>::ProblemType::OPTIMAL) {
+  } else if (feasibility == MCF::OPTIMAL) {
     feasibility_type = "OPTIMAL";
   } else {
     feasibility_type = "UNBOUNDED";
   }
-  std::vector<int> arcFlows;
-  std::vector<int> nodePots;
 
-  for (size_t i = 0; i < arcs.size(); ++i) {
-    arcFlows.push_back(runner.flow(arcs[i]));
+  std::vector<Value> arcFlows;
+  std::vector<Cost> nodePots;
+
+  for (int i = 0; i < NUM_ARCS; ++i) {
+    arcFlows.push_back(runner.flow(h.arcs[i]));
   }
 
   for (int i = 0; i < numNodes; ++i) {
-    nodePots.push_back(runner.potential(nodes[i]));
+    nodePots.push_back(runner.potential(h.nodes[i]));
   }
 
-  return Rcpp::List::create(arcFlows, nodePots, runner.totalCost(),
+  return Rcpp::List::create(arcFlows, nodePots,
+                            runner.template totalCost<double>(),
                             feasibility_type);
 }
 
-//' @rdname lemon_runners
-// [[Rcpp::export]]
-Rcpp::List CapacityScalingRunner(std::vector<int> arcSources,
-                                 std::vector<int> arcTargets,
-                                 std::vector<int> arcCapacities,
-                                 std::vector<int> arcCosts,
-                                 std::vector<int> nodeSupplies, int numNodes) {
-  ListDigraph g;
-  std::vector<ListDigraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
+// Runs `runner` with its default method. The overloads below run
+// NetworkSimplex with the pivot rule, and CostScaling with the method,
+// numbered `method` in LEMON's PivotRule and Method enums, or with their
+// defaults if `method` is negative.
+template <typename MCF>
+inline typename MCF::ProblemType RunMinCostFlowMethod(MCF &runner, int) {
+  return runner.run();
+}
+
+template <typename GR, typename V, typename C>
+inline typename NetworkSimplex<GR, V, C>::ProblemType
+RunMinCostFlowMethod(NetworkSimplex<GR, V, C> &runner, int method) {
+  if (method < 0) {
+    return runner.run();
+  }
+  return runner.run(typename NetworkSimplex<GR, V, C>::PivotRule(method));
+}
+
+template <typename GR, typename V, typename C>
+inline typename CostScaling<GR, V, C>::ProblemType
+RunMinCostFlowMethod(CostScaling<GR, V, C> &runner, int method) {
+  if (method < 0) {
+    return runner.run();
   }
-  std::vector<ListDigraph::Arc> arcs;
-  int NUM_ARCS = arcSources.size();
+  return runner.run(typename CostScaling<GR, V, C>::Method(method));
+}
 
-  ListDigraph::ArcMap<int> costs(g);
-  ListDigraph::ArcMap<int> capacities(g);
-  ListDigraph::NodeMap<int> supplies(g);
+// Solves the minimum cost flow problem on `h` with `MCF`, an instantiation
+// of NetworkSimplex, CostScaling, CapacityScaling or CycleCanceling, using
+// the method numbered `method` where the algorithm has a choice.
+template <typename MCF>
+inline Rcpp::List SolveMinCostFlow(const DigraphHandle &h,
+                                   const std::vector<double> &arcCapacities,
+                                   const std::vector<double> &arcCosts,
+                                   const std::vector<double> &nodeSupplies,
+                                   int method) {
+  typedef DigraphHandle::Digraph Digraph;
+  typedef typename MCF::Value Value;
+  typedef typename MCF::Cost Cost;
+  const Digraph &g = h.g;
+  int numNodes = h.nodes.size();
+  int NUM_ARCS = h.arcs.size();
+
+  Digraph::ArcMap<Cost> costs(g);
+  Digraph::ArcMap<Value> capacities(g);
+  Digraph::NodeMap<Value> supplies(g);
 
   for (int i = 0; i < numNodes; ++i) {
-    supplies[nodes[i]] = nodeSupplies[i];
+    supplies[h.nodes[i]] = nodeSupplies[i];
   }
 
   for (int i = 0; i < NUM_ARCS; ++i) {
-    ListDigraph::Arc a =
-        g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    costs[a] = arcCosts[i];
-    capacities[a] = arcCapacities[i];
-    arcs.push_back(a);
+    costs[h.arcs[i]] = arcCosts[i];
+    capacities[h.arcs[i]] = arcCapacities[i];
   }
 
-  CapacityScaling<ListDigraph, int, int> runner(g);
+  MCF runner(g);
   runner.upperMap(capacities);
   runner.costMap(costs);
   runner.supplyMap(supplies);
-  CapacityScaling<ListDigraph, int, int>::ProblemType feasibility =
-      runner.run();
-  std::string feasibility_type = "";
-  if (feasibility ==
-      CapacityScaling<ListDigraph, int, int>::ProblemType::INFEASIBLE) {
-    feasibility_type = "INFEASIBLE";
-  } else if (feasibility ==
-             CapacityScaling<ListDigraph, int, int>::ProblemType::OPTIMAL) {
-    feasibility_type = "OPTIMAL";
-  } else {
-    feasibility_type = "UNBOUNDED";
-  }
-
-  std::vector<int> arcFlows;
-  std::vector<int> nodePots;
+  typename MCF::ProblemType feasibility =
+      RunMinCostFlowMethod(runner, method);
+  return MinCostFlowResult(h, runner, feasibility);
+}
 
-  for (size_t i = 0; i < arcs.size(); ++i) {
-    arcFlows.push_back(runner.flow(arcs[i]));
+// Whether a minimum cost flow problem can be solved in int arithmetic. Every
+// value must fit in an int, and the total supply and the sum of the absolute
+// arc costs, which bound the flow excesses and node potentials the
+// algorithms build up, must stay well inside the int range.
+inline bool MinCostFlowFitsInt(const std::vector<double> &arcCapacities,
+                               const std::vector<double> &arcCosts,
+                               const std::vector<double> &nodeSupplies) {
+  if (!IsIntegral(arcCapacities) || !IsIntegral(arcCosts) ||
+      !IsIntegral(nodeSupplies)) {
+    return false;
   }
-
-  for (int i = 0; i < numNodes; ++i) {
-    nodePots.push_back(runner.potential(nodes[i]));
+  const double LIMIT = INT_MAX / 4;
+  double totalSupply = 0, totalCost = 0;
+  for (size_t i = 0; i < nodeSupplies.size(); ++i) {
+    totalSupply += std::fabs(nodeSupplies[i]);
   }
-
-  return Rcpp::List::create(arcFlows, nodePots, runner.totalCost(),
-                            feasibility_type);
+  for (size_t i = 0; i < arcCosts.size(); ++i) {
+    totalCost += std::fabs(arcCosts[i]);
+  }
+  return totalSupply <= LIMIT && totalCost <= LIMIT;
 }
 
-//' @rdname lemon_runners
-// [[Rcpp::export]]
-Rcpp::List CostScalingRunner(std::vector<int> arcSources,
-                             std::vector<int> arcTargets,
-                             std::vector<int> arcCapacities,
-                             std::vector<int> arcCosts,
-                             std::vector<int> nodeSupplies, int numNodes) {
-  ListDigraph g;
-  std::vector<ListDigraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
+// Solves the minimum cost flow problem on `h` with the LEMON algorithm
+// `MCF` (one of the aliases below), using int flows and costs when
+// MinCostFlowFitsInt and long long otherwise, and the method numbered
+// `method` as in RunMinCostFlowMethod. These algorithms are only correct for
+// integer data, so non-integer values are an error rather than being
+// truncated.
+template <template <typename, typename> class MCF>
+inline Rcpp::List RunMinCostFlow(const DigraphHandle &h,
+                                 const std::vector<double> &arcCapacities,
+                                 const std::vector<double> &arcCosts,
+                                 const std::vector<double> &nodeSupplies,
+                                 int method = -1) {
+  RequireIntegral(arcCapacities, "Arc capacities");
+  RequireIntegral(arcCosts, "Arc costs");
+  RequireIntegral(nodeSupplies, "Node supplies");
+  if (MinCostFlowFitsInt(arcCapacities, arcCosts, nodeSupplies)) {
+    return SolveMinCostFlow<MCF<int, int> >(h, arcCapacities, arcCosts,
+                                            nodeSupplies, method);
   }
-  std::vector<ListDigraph::Arc> arcs;
-  int NUM_ARCS = arcSources.size();
+  return SolveMinCostFlow<MCF<long long, long long> >(
+      h, arcCapacities, arcCosts, nodeSupplies, method);
+}
 
-  ListDigraph::ArcMap<int> costs(g);
-  ListDigraph::ArcMap<int> capacities(g);
-  ListDigraph::NodeMap<int> supplies(g);
+// The NetworkSimplex pivot rules and the CostScaling methods, as named in
+// R, in the order of LEMON's PivotRule and Method enums.
+const std::vector<std::string> PIVOT_RULES = {
+    "FirstEligible", "BestEligible", "BlockSearch", "CandidateList",
+    "AlteringList"};
+const std::vector<std::string> COST_SCALING_METHODS = {"Push", "Augment",
+                                                       "PartialAugment"};
+
+// The methods chosen by "Auto", by graph signature: the algorithm, and the
+// node count and average degree of the graph rounded down to powers of two.
+// Graphs with the same signature are assumed to favor the same method.
+typedef std::tuple<std::string, int, int> MinCostFlowSignature;
+
+inline std::map<MinCostFlowSignature, int> &MinCostFlowTunedMethods() {
+  static std::map<MinCostFlowSignature, int> tuned;
+  return tuned;
+}
 
-  for (int i = 0; i < numNodes; ++i) {
-    supplies[nodes[i]] = nodeSupplies[i];
+inline MinCostFlowSignature GetMinCostFlowSignature(const DigraphHandle &h,
+                                                    const std::string &alg) {
+  int numNodes = h.nodes.size();
+  int degree = static_cast<int>(h.arcs.size()) / std::max(numNodes, 1);
+  return MinCostFlowSignature(alg, std::ilogb(numNodes + 1),
+                              std::ilogb(degree + 1));
+}
+
+// Solves the problem with `MCF` using the method called `method`, one of
+// `methods`. "Auto" uses the method cached for the signature of `h`, if
+// there is one. Otherwise it solves the problem with each method in turn,
+// caches the fastest, and returns its result.
+template <template <typename, typename> class MCF>
+inline Rcpp::List RunMinCostFlowTuned(const DigraphHandle &h,
+                                      const std::vector<double> &arcCapacities,
+                                      const std::vector<double> &arcCosts,
+                                      const std::vector<double> &nodeSupplies,
+                                      const std::string &alg,
+                                      const std::vector<std::string> &methods,
+                                      const std::string &method) {
+  int NUM_METHODS = methods.size();
+  if (method != "Auto") {
+    for (int i = 0; i < NUM_METHODS; ++i) {
+      if (methods[i] == method) {
+        return RunMinCostFlow<MCF>(h, arcCapacities, arcCosts, nodeSupplies,
+                                   i);
+      }
+    }
+    Rcpp::stop("Invalid method.");
   }
 
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    ListDigraph::Arc a =
-        g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    costs[a] = arcCosts[i];
-    capacities[a] = arcCapacities[i];
-    arcs.push_back(a);
+  std::map<MinCostFlowSignature, int> &tuned = MinCostFlowTunedMethods();
+  MinCostFlowSignature signature = GetMinCostFlowSignature(h, alg);
+  std::map<MinCostFlowSignature, int>::iterator it = tuned.find(signature);
+  if (it != tuned.end()) {
+    return RunMinCostFlow<MCF>(h, arcCapacities, arcCosts, nodeSupplies,
+                               it->second);
   }
 
-  CostScaling<ListDigraph, int, int> runner(g);
-  runner.upperMap(capacities);
-  runner.costMap(costs);
-  runner.supplyMap(supplies);
-  CostScaling<ListDigraph, int, int>::ProblemType feasibility = runner.run();
-  std::string feasibility_type = "";
-  if (feasibility ==
-      CostScaling<ListDigraph, int, int>::ProblemType::INFEASIBLE) {
-    feasibility_type = "INFEASIBLE";
-  } else if (feasibility ==
-             CostScaling<ListDigraph, int, int>::ProblemType::OPTIMAL) {
-    feasibility_type = "OPTIMAL";
-  } else {
-    feasibility_type = "UNBOUNDED";
+  Rcpp::List best;
+  double bestTime = 0;
+  int bestMethod = 0;
+  for (int i = 0; i < NUM_METHODS; ++i) {
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    Rcpp::List result =
+        RunMinCostFlow<MCF>(h, arcCapacities, arcCosts, nodeSupplies, i);
+    double time = std::chrono::duration<double>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+    if (i == 0 || time < bestTime) {
+      best = result;
+      bestTime = time;
+      bestMethod = i;
+    }
   }
+  tuned[signature] = bestMethod;
+  return best;
+}
 
-  std::vector<int> arcFlows;
-  std::vector<int> nodePots;
+// The algorithms differ in their template parameters; these aliases let
+// RunMinCostFlow instantiate any of them with given Value and Cost types.
+template <typename V, typename C>
+using NetworkSimplexAlg = NetworkSimplex<DigraphHandle::Digraph, V, C>;
+template <typename V, typename C>
+using CostScalingAlg = CostScaling<DigraphHandle::Digraph, V, C>;
+template <typename V, typename C>
+using CapacityScalingAlg = CapacityScaling<DigraphHandle::Digraph, V, C>;
+template <typename V, typename C>
+using CycleCancelingAlg = CycleCanceling<DigraphHandle::Digraph, V, C>;
 
-  for (size_t i = 0; i < arcs.size(); ++i) {
-    arcFlows.push_back(runner.flow(arcs[i]));
-  }
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List CycleCancellingRunner(std::vector<int> arcSources,
+                                 std::vector<int> arcTargets,
+                                 std::vector<double> arcCapacities,
+                                 std::vector<double> arcCosts,
+                                 std::vector<double> nodeSupplies,
+                                 int numNodes) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  return RunMinCostFlow<CycleCancelingAlg>(h, arcCapacities, arcCosts,
+                                           nodeSupplies);
+}
 
-  for (int i = 0; i < numNodes; ++i) {
-    nodePots.push_back(runner.potential(nodes[i]));
-  }
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List CycleCancellingGraphRunner(SEXP graph,
+                                      std::vector<double> arcCapacities,
+                                      std::vector<double> arcCosts,
+                                      std::vector<double> nodeSupplies) {
+  return RunMinCostFlow<CycleCancelingAlg>(GetDigraph(graph), arcCapacities,
+                                           arcCosts, nodeSupplies);
+}
 
-  return Rcpp::List::create(arcFlows, nodePots, runner.totalCost(),
-                            feasibility_type);
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List CapacityScalingRunner(std::vector<int> arcSources,
+                                 std::vector<int> arcTargets,
+                                 std::vector<double> arcCapacities,
+                                 std::vector<double> arcCosts,
+                                 std::vector<double> nodeSupplies,
+                                 int numNodes) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  return RunMinCostFlow<CapacityScalingAlg>(h, arcCapacities, arcCosts,
+                                            nodeSupplies);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List CapacityScalingGraphRunner(SEXP graph,
+                                      std::vector<double> arcCapacities,
+                                      std::vector<double> arcCosts,
+                                      std::vector<double> nodeSupplies) {
+  return RunMinCostFlow<CapacityScalingAlg>(GetDigraph(graph), arcCapacities,
+                                            arcCosts, nodeSupplies);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List CostScalingRunner(std::vector<int> arcSources,
+                             std::vector<int> arcTargets,
+                             std::vector<double> arcCapacities,
+                             std::vector<double> arcCosts,
+                             std::vector<double> nodeSupplies, int numNodes,
+                             std::string method) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  return RunMinCostFlowTuned<CostScalingAlg>(h, arcCapacities, arcCosts,
+                                             nodeSupplies, "CostScaling",
+                                             COST_SCALING_METHODS, method);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List CostScalingGraphRunner(SEXP graph, std::vector<double> arcCapacities,
+                                  std::vector<double> arcCosts,
+                                  std::vector<double> nodeSupplies,
+                                  std::string method) {
+  return RunMinCostFlowTuned<CostScalingAlg>(
+      GetDigraph(graph), arcCapacities, arcCosts, nodeSupplies, "CostScaling",
+      COST_SCALING_METHODS, method);
 }
 
 //' @rdname lemon_runners
 // [[Rcpp::export]]
 Rcpp::List NetworkSimplexRunner(std::vector<int> arcSources,
                                 std::vector<int> arcTargets,
-                                std::vector<int> arcCapacities,
-                                std::vector<int> arcCosts,
-                                std::vector<int> nodeSupplies, int numNodes) {
-  ListDigraph g;
-  std::vector<ListDigraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  std::vector<ListDigraph::Arc> arcs;
-  int NUM_ARCS = arcSources.size();
+                                std::vector<double> arcCapacities,
+                                std::vector<double> arcCosts,
+                                std::vector<double> nodeSupplies,
+                                int numNodes, std::string method) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  return RunMinCostFlowTuned<NetworkSimplexAlg>(h, arcCapacities, arcCosts,
+                                                nodeSupplies, "NetworkSimplex",
+                                                PIVOT_RULES, method);
+}
 
-  ListDigraph::ArcMap<int> costs(g);
-  ListDigraph::ArcMap<int> capacities(g);
-  ListDigraph::NodeMap<int> supplies(g);
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List NetworkSimplexGraphRunner(SEXP graph,
+                                     std::vector<double> arcCapacities,
+                                     std::vector<double> arcCosts,
+                                     std::vector<double> nodeSupplies,
+                                     std::string method) {
+  return RunMinCostFlowTuned<NetworkSimplexAlg>(
+      GetDigraph(graph), arcCapacities, arcCosts, nodeSupplies,
+      "NetworkSimplex", PIVOT_RULES, method);
+}
 
-  for (int i = 0; i < numNodes; ++i) {
-    supplies[nodes[i]] = nodeSupplies[i];
+// A network simplex solver kept in C++ memory between calls, so that a
+// sequence of related problems on the same network can each be solved from
+// the optimal basis of the previous one with NetworkSimplex::rerun(). Flows
+// and costs are always long long, as later updates may not fit in an int.
+struct MinCostFlowSolver {
+  typedef NetworkSimplex<DigraphHandle::Digraph, long long, long long>
+      Simplex;
+
+  DigraphHandle h;
+  std::unique_ptr<Simplex> simplex;
+};
+
+inline MinCostFlowSolver &GetMinCostFlowSolver(SEXP solver) {
+  Rcpp::XPtr<MinCostFlowSolver> ptr(solver);
+  if (ptr.get() == NULL) {
+    Rcpp::stop("The min cost flow solver is no longer valid (was it saved "
+               "and reloaded?); rebuild it with BuildMinCostFlowSolver().");
   }
+  return *ptr;
+}
 
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    ListDigraph::Arc a =
-        g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    costs[a] = arcCosts[i];
-    capacities[a] = arcCapacities[i];
-    arcs.push_back(a);
+// Replaces the capacities, costs and supplies of `mcf` with those given.
+// Empty vectors leave the corresponding values unchanged.
+inline void UpdateMinCostFlowSolver(MinCostFlowSolver &mcf,
+                                    const std::vector<double> &arcCapacities,
+                                    const std::vector<double> &arcCosts,
+                                    const std::vector<double> &nodeSupplies) {
+  typedef DigraphHandle::Digraph Digraph;
+  const DigraphHandle &h = mcf.h;
+  RequireIntegral(arcCapacities, "Arc capacities");
+  RequireIntegral(arcCosts, "Arc costs");
+  RequireIntegral(nodeSupplies, "Node supplies");
+
+  if (!arcCapacities.empty()) {
+    Digraph::ArcMap<long long> capacities(h.g);
+    for (size_t i = 0; i < h.arcs.size(); ++i) {
+      capacities[h.arcs[i]] = arcCapacities[i];
+    }
+    mcf.simplex->upperMap(capacities);
   }
-
-  NetworkSimplex<ListDigraph, int, int> runner(g);
-  runner.upperMap(capacities);
-  runner.costMap(costs);
-  runner.supplyMap(supplies);
-  NetworkSimplex<ListDigraph, int, int>::ProblemType feasibility = runner.run();
-  std::string feasibility_type = "";
-  if (feasibility ==
-      NetworkSimplex<ListDigraph, int, int>::ProblemType::INFEASIBLE) {
-    feasibility_type = "INFEASIBLE";
-  } else if (feasibility ==
-             NetworkSimplex<ListDigraph, int, int>::ProblemType::OPTIMAL) {
-    feasibility_type = "OPTIMAL";
-  } else {
-    feasibility_type = "UNBOUNDED";
+  if (!arcCosts.empty()) {
+    Digraph::ArcMap<long long> costs(h.g);
+    for (size_t i = 0; i < h.arcs.size(); ++i) {
+      costs[h.arcs[i]] = arcCosts[i];
+    }
+    mcf.simplex->costMap(costs);
   }
-
-  std::vector<int> arcFlows;
-  std::vector<int> nodePots;
-
-  for (size_t i = 0; i < arcs.size(); ++i) {
-    arcFlows.push_back(runner.flow(arcs[i]));
+  if (!nodeSupplies.empty()) {
+    Digraph::NodeMap<long long> supplies(h.g);
+    for (size_t i = 0; i < h.nodes.size(); ++i) {
+      supplies[h.nodes[i]] = nodeSupplies[i];
+    }
+    mcf.simplex->supplyMap(supplies);
   }
+}
 
-  for (int i = 0; i < numNodes; ++i) {
-    nodePots.push_back(runner.potential(nodes[i]));
-  }
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+SEXP NetworkSimplexSolverRunner(std::vector<int> arcSources,
+                                std::vector<int> arcTargets,
+                                std::vector<double> arcCapacities,
+                                std::vector<double> arcCosts,
+                                std::vector<double> nodeSupplies,
+                                int numNodes) {
+  Rcpp::XPtr<MinCostFlowSolver> ptr(new MinCostFlowSolver(), true);
+  BuildDigraph(ptr->h, arcSources, arcTargets, numNodes);
+  ptr->simplex.reset(new MinCostFlowSolver::Simplex(ptr->h.g));
+  UpdateMinCostFlowSolver(*ptr, arcCapacities, arcCosts, nodeSupplies);
+  return ptr;
+}
 
-  return Rcpp::List::create(arcFlows, nodePots, runner.totalCost(),
-                            feasibility_type);
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+void NetworkSimplexSolverUpdateRunner(SEXP solver,
+                                      std::vector<double> arcCapacities,
+                                      std::vector<double> arcCosts,
+                                      std::vector<double> nodeSupplies) {
+  UpdateMinCostFlowSolver(GetMinCostFlowSolver(solver), arcCapacities,
+                          arcCosts, nodeSupplies);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List NetworkSimplexSolverSolveRunner(SEXP solver) {
+  MinCostFlowSolver &mcf = GetMinCostFlowSolver(solver);
+  MinCostFlowSolver::Simplex::ProblemType feasibility = mcf.simplex->rerun();
+  return MinCostFlowResult(mcf.h, *mcf.simplex, feasibility);
 }
@@ -1,21 +1,27 @@
-#include "lemon/gomory_hu.h"
 #include "lemon/hao_orlin.h"
 #include "lemon/list_graph.h"
 #include "lemon/nagamochi_ibaraki.h"
+#include "karger_stein.h"
+#include "parallel_gomory_hu.h"
+#include "value_type.h"
 #include <Rcpp.h>
+#include <limits>
 #include <vector>
 
 using namespace lemon;
 using namespace std;
 
-//' @rdname lemon_runners
-// [[Rcpp::export]]
-Rcpp::List NagamochiIbarakiRunner(std::vector<int> arcSources,
-                                  std::vector<int> arcTargets,
-                                  std::vector<int> arcWeights, int numNodes) {
+// Finds a minimum cut of the undirected graph with edge weights of type
+// `Value` using the Nagamochi-Ibaraki algorithm. Only used with int weights:
+// see NagamochiIbarakiRunner().
+template <typename Value>
+inline Rcpp::List RunNagamochiIbaraki(const std::vector<int> &arcSources,
+                                      const std::vector<int> &arcTargets,
+                                      const std::vector<double> &arcWeights,
+                                      int numNodes) {
   ListGraph g;
   std::vector<ListGraph::Node> nodes;
-  ListGraph::EdgeMap<int> dists(g);
+  ListGraph::EdgeMap<Value> dists(g);
   for (int i = 0; i < numNodes; ++i) {
     ListGraph::Node n = g.addNode();
     nodes.push_back(n);
@@ -30,13 +36,13 @@ Rcpp::List NagamochiIbarakiRunner(std::vector<int> arcSources,
     dists[a] = arcWeights[i];
     arcs.push_back(a);
   }
-  NagamochiIbaraki<ListGraph, ListGraph::EdgeMap<int> > alg(g, dists);
+  NagamochiIbaraki<ListGraph, ListGraph::EdgeMap<Value> > alg(g, dists);
   alg.run();
 
   ListGraph::NodeMap<int> mincutmap(g);
   alg.minCutMap(mincutmap);
 
-  int mincutvalue = alg.minCutValue();
+  Value mincutvalue = alg.minCutValue();
   vector<int> partition1;
   vector<int> partition2;
   for (int i = 0; i < numNodes; ++i) {
@@ -50,14 +56,68 @@ Rcpp::List NagamochiIbarakiRunner(std::vector<int> arcSources,
   return Rcpp::List::create(mincutvalue, partition1, partition2);
 }
 
+// Finds a minimum cut of the undirected graph with edge weights of type
+// `Value` using KargerStein, with `repetitions` runs spread over
+// `numThreads` threads.
+template <typename Value>
+inline Rcpp::List RunKargerStein(const std::vector<int> &arcSources,
+                                 const std::vector<int> &arcTargets,
+                                 const std::vector<double> &arcWeights,
+                                 int numNodes, int repetitions,
+                                 int numThreads, unsigned int seed) {
+  if (numNodes < 2) {
+    Rcpp::stop("The graph must have at least two nodes.");
+  }
+  int NUM_ARCS = arcSources.size();
+  std::vector<int> sources(NUM_ARCS), targets(NUM_ARCS);
+  std::vector<Value> weights(NUM_ARCS);
+  for (int i = 0; i < NUM_ARCS; ++i) {
+    sources[i] = arcSources[i] - 1;
+    targets[i] = arcTargets[i] - 1;
+    weights[i] = arcWeights[i];
+  }
+  KargerStein<Value> alg(numNodes, sources, targets, weights, repetitions,
+                         numThreads, seed);
+  alg.run();
+
+  Value mincutvalue = alg.minCutValue();
+  vector<int> partition1;
+  vector<int> partition2;
+  for (int i = 0; i < numNodes; ++i) {
+    if (alg.minCut(i)) {
+      partition1.push_back(i);
+    } else {
+      partition2.push_back(i);
+    }
+  }
+
+  return Rcpp::List::create(mincutvalue, partition1, partition2);
+}
+
 //' @rdname lemon_runners
 // [[Rcpp::export]]
-Rcpp::List HaoOrlinRunner(std::vector<int> arcSources,
-                          std::vector<int> arcTargets,
-                          std::vector<int> arcWeights, int numNodes) {
+Rcpp::List KargerSteinRunner(std::vector<int> arcSources,
+                             std::vector<int> arcTargets,
+                             std::vector<double> arcWeights, int numNodes,
+                             int repetitions, int numThreads, int seed) {
+  if (IsIntegral(arcWeights)) {
+    return RunKargerStein<int>(arcSources, arcTargets, arcWeights, numNodes,
+                               repetitions, numThreads, (unsigned int)seed);
+  }
+  return RunKargerStein<double>(arcSources, arcTargets, arcWeights, numNodes,
+                                repetitions, numThreads, (unsigned int)seed);
+}
+
+// Finds a minimum cut of the directed graph with arc weights of type `Value`
+// using the Hao-Orlin algorithm.
+template <typename Value>
+inline Rcpp::List RunHaoOrlin(const std::vector<int> &arcSources,
+                              const std::vector<int> &arcTargets,
+                              const std::vector<double> &arcWeights,
+                              int numNodes) {
   ListDigraph g;
   std::vector<ListDigraph::Node> nodes;
-  ListDigraph::ArcMap<int> dists(g);
+  ListDigraph::ArcMap<Value> dists(g);
   for (int i = 0; i < numNodes; ++i) {
     ListDigraph::Node n = g.addNode();
     nodes.push_back(n);
@@ -72,13 +132,13 @@ Rcpp::List HaoOrlinRunner(std::vector<int> arcSources,
     dists[a] = arcWeights[i];
     arcs.push_back(a);
   }
-  HaoOrlin<ListDigraph, ListDigraph::ArcMap<int> > alg(g, dists);
+  HaoOrlin<ListDigraph, ListDigraph::ArcMap<Value> > alg(g, dists);
   alg.run();
 
   ListDigraph::NodeMap<int> mincutmap(g);
   alg.minCutMap(mincutmap);
 
-  int mincutvalue = alg.minCutValue();
+  Value mincutvalue = alg.minCutValue();
   vector<int> partition1;
   vector<int> partition2;
   for (int i = 0; i < numNodes; ++i) {
@@ -94,12 +154,48 @@ Rcpp::List HaoOrlinRunner(std::vector<int> arcSources,
 
 //' @rdname lemon_runners
 // [[Rcpp::export]]
-Rcpp::List GomoryHuTreeRunner(std::vector<int> arcSources,
-                              std::vector<int> arcTargets,
-                              std::vector<int> arcWeights, int numNodes) {
+Rcpp::List HaoOrlinRunner(std::vector<int> arcSources,
+                          std::vector<int> arcTargets,
+                          std::vector<double> arcWeights, int numNodes) {
+  if (IsIntegral(arcWeights)) {
+    return RunHaoOrlin<int>(arcSources, arcTargets, arcWeights, numNodes);
+  }
+  return RunHaoOrlin<double>(arcSources, arcTargets, arcWeights, numNodes);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List NagamochiIbarakiRunner(std::vector<int> arcSources,
+                                  std::vector<int> arcTargets,
+                                  std::vector<double> arcWeights,
+                                  int numNodes) {
+  if (IsIntegral(arcWeights)) {
+    return RunNagamochiIbaraki<int>(arcSources, arcTargets, arcWeights,
+                                    numNodes);
+  }
+  // LEMON's NagamochiIbaraki compares cut values exactly, and rounding can
+  // leave a phase with no edge to contract, so it never ends on doubles.
+  // Other weights go to Hao-Orlin instead, with each edge as an arc both
+  // ways, whose minimum cut is the same.
+  std::vector<int> sources(arcSources), targets(arcTargets);
+  std::vector<double> weights(arcWeights);
+  sources.insert(sources.end(), arcTargets.begin(), arcTargets.end());
+  targets.insert(targets.end(), arcSources.begin(), arcSources.end());
+  weights.insert(weights.end(), arcWeights.begin(), arcWeights.end());
+  return RunHaoOrlin<double>(sources, targets, weights, numNodes);
+}
+
+// Builds the Gomory-Hu tree of the undirected graph with edge weights of
+// type `Value`, computing its minimum cuts on `numThreads` threads. The tree
+// is the same as lemon::GomoryHu's for any number of threads.
+template <typename Value>
+inline Rcpp::List RunGomoryHuTree(const std::vector<int> &arcSources,
+                                  const std::vector<int> &arcTargets,
+                                  const std::vector<double> &arcWeights,
+                                  int numNodes, int numThreads) {
   ListGraph g;
   std::vector<ListGraph::Node> nodes;
-  ListGraph::EdgeMap<Cost> dists(g);
+  ListGraph::EdgeMap<Value> dists(g);
   for (int i = 0; i < numNodes; ++i) {
     ListGraph::Node n = g.addNode();
     nodes.push_back(n);
@@ -114,16 +210,17 @@ Rcpp::List GomoryHuTreeRunner(std::vector<int> arcSources,
     dists[a] = arcWeights[i];
     arcs.push_back(a);
   }
-  GomoryHu<ListGraph, ListGraph::EdgeMap<Cost> > alg(g, dists);
+  ParallelGomoryHu<ListGraph, ListGraph::EdgeMap<Value> > alg(g, dists,
+                                                              numThreads);
   alg.run();
 
   std::vector<int> predecessors;
-  std::vector<int> predEdgeWeights;
-  std::vector<int> rootDistances;
+  std::vector<Value> predEdgeWeights;
+  std::vector<Value> rootDistances;
   for (int i = 0; i < numNodes; ++i) {
     int predNodeLoc = g.id(alg.predNode(nodes[i]));
-    int predNodeWeight = alg.predValue(nodes[i]);
-    int rootDistance = alg.rootDist(nodes[i]);
+    Value predNodeWeight = alg.predValue(nodes[i]);
+    Value rootDistance = alg.rootDist(nodes[i]);
 
     if (predNodeLoc != -1) {
       predEdgeWeights.push_back(predNodeWeight);
@@ -137,3 +234,235 @@ Rcpp::List GomoryHuTreeRunner(std::vector<int> arcSources,
 
   return Rcpp::List::create(predecessors, predEdgeWeights, rootDistances);
 }
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List GomoryHuTreeRunner(std::vector<int> arcSources,
+                              std::vector<int> arcTargets,
+                              std::vector<double> arcWeights, int numNodes,
+                              int numThreads) {
+  if (IsIntegral(arcWeights)) {
+    return RunGomoryHuTree<int>(arcSources, arcTargets, arcWeights, numNodes,
+                                numThreads);
+  }
+  return RunGomoryHuTree<double>(arcSources, arcTargets, arcWeights, numNodes,
+                                 numThreads);
+}
+
+// A Gomory-Hu tree prepared for minimum cut queries. The minimum cut between
+// two nodes is the lightest tree edge on the path between them, found with
+// binary lifting: up[k][v] is the ancestor 2^k edges above v (the root is
+// its own parent), low[k][v] the lightest edge on the way there and
+// lowNode[k][v] the lower end of that edge, the one nearest the ancestor on
+// ties. Each tree edge is identified by its lower end. The edge's subtree,
+// nodes first[v] to last[v] in preorder, is one side of the cut.
+struct MinCutIndex {
+  int numNodes = 0;
+  std::vector<int> depth, first, last;
+  std::vector<std::vector<int> > up, lowNode;
+  std::vector<std::vector<double> > low;
+};
+
+inline MinCutIndex &GetMinCutIndex(SEXP index) {
+  Rcpp::XPtr<MinCutIndex> ptr(index);
+  if (ptr.get() == NULL) {
+    Rcpp::stop("The minimum cut index is no longer valid (was it saved and "
+               "reloaded?); rebuild it with BuildMinCutIndex().");
+  }
+  return *ptr;
+}
+
+// Builds the Gomory-Hu tree of the undirected graph with edge weights of
+// type `Value` into `index`.
+template <typename Value>
+inline void BuildMinCutIndex(MinCutIndex &index,
+                             const std::vector<int> &arcSources,
+                             const std::vector<int> &arcTargets,
+                             const std::vector<double> &arcWeights,
+                             int numNodes, int numThreads) {
+  if (numNodes == 0) {
+    // There is no tree to walk and no pair of nodes to query.
+    index = MinCutIndex();
+    return;
+  }
+  ListGraph g;
+  std::vector<ListGraph::Node> nodes;
+  ListGraph::EdgeMap<Value> dists(g);
+  for (int i = 0; i < numNodes; ++i) {
+    ListGraph::Node n = g.addNode();
+    nodes.push_back(n);
+  }
+  int NUM_ARCS = arcSources.size();
+  for (int i = 0; i < NUM_ARCS; ++i) {
+    ListGraph::Edge a =
+        g.addEdge(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
+    dists[a] = arcWeights[i];
+  }
+  ParallelGomoryHu<ListGraph, ListGraph::EdgeMap<Value> > alg(g, dists,
+                                                              numThreads);
+  alg.run();
+
+  // The parent and parent edge weight of each node, and its children.
+  int root = 0;
+  std::vector<int> pred(numNodes);
+  std::vector<double> weight(numNodes);
+  std::vector<std::vector<int> > children(numNodes);
+  for (int i = 0; i < numNodes; ++i) {
+    ListGraph::Node p = alg.predNode(nodes[i]);
+    if (p == INVALID) {
+      root = i;
+      pred[i] = i;
+      weight[i] = std::numeric_limits<double>::infinity();
+    } else {
+      pred[i] = g.id(p);
+      weight[i] = alg.predValue(nodes[i]);
+      children[pred[i]].push_back(i);
+    }
+  }
+
+  index.numNodes = numNodes;
+  index.depth.assign(numNodes, 0);
+  index.first.assign(numNodes, 0);
+  index.last.assign(numNodes, 0);
+  int position = 0;
+  std::vector<std::pair<int, size_t> > stack(1, std::make_pair(root, 0));
+  index.first[root] = position++;
+  while (!stack.empty()) {
+    int v = stack.back().first;
+    size_t &next = stack.back().second;
+    if (next < children[v].size()) {
+      int c = children[v][next++];
+      index.depth[c] = index.depth[v] + 1;
+      index.first[c] = position++;
+      stack.push_back(std::make_pair(c, 0));
+    } else {
+      index.last[v] = position - 1;
+      stack.pop_back();
+    }
+  }
+
+  int levels = 1;
+  while ((1 << levels) < numNodes) {
+    ++levels;
+  }
+  index.up.assign(levels, std::vector<int>(numNodes));
+  index.lowNode.assign(levels, std::vector<int>(numNodes));
+  index.low.assign(levels, std::vector<double>(numNodes));
+  for (int v = 0; v < numNodes; ++v) {
+    index.up[0][v] = pred[v];
+    index.lowNode[0][v] = v;
+    index.low[0][v] = weight[v];
+  }
+  for (int k = 1; k < levels; ++k) {
+    for (int v = 0; v < numNodes; ++v) {
+      int mid = index.up[k - 1][v];
+      index.up[k][v] = index.up[k - 1][mid];
+      if (index.low[k - 1][mid] <= index.low[k - 1][v]) {
+        index.low[k][v] = index.low[k - 1][mid];
+        index.lowNode[k][v] = index.lowNode[k - 1][mid];
+      } else {
+        index.low[k][v] = index.low[k - 1][v];
+        index.lowNode[k][v] = index.lowNode[k - 1][v];
+      }
+    }
+  }
+}
+
+// Moves `v` 2^k edges up the tree, keeping the lightest edge passed in
+// `value` and `edge`.
+inline void ClimbMinCutIndex(const MinCutIndex &index, int k, int &v,
+                             double &value, int &edge) {
+  if (index.low[k][v] <= value) {
+    value = index.low[k][v];
+    edge = index.lowNode[k][v];
+  }
+  v = index.up[k][v];
+}
+
+// Finds the minimum cut between the distinct nodes `s` and `t` (0-indexed).
+// Returns its value, and sets `edge` to the tree edge giving the cut and
+// `sourceBelow` to whether `s` lies in that edge's subtree.
+inline double QueryMinCutIndex(const MinCutIndex &index, int s, int t,
+                               int &edge, bool &sourceBelow) {
+  int levels = index.up.size();
+  double sValue = std::numeric_limits<double>::infinity();
+  double tValue = sValue;
+  int sEdge = s, tEdge = t;
+  for (int k = levels - 1; k >= 0; --k) {
+    if (index.depth[s] - (1 << k) >= index.depth[t]) {
+      ClimbMinCutIndex(index, k, s, sValue, sEdge);
+    } else if (index.depth[t] - (1 << k) >= index.depth[s]) {
+      ClimbMinCutIndex(index, k, t, tValue, tEdge);
+    }
+  }
+  for (int k = levels - 1; k >= 0 && s != t; --k) {
+    if (index.up[k][s] != index.up[k][t]) {
+      ClimbMinCutIndex(index, k, s, sValue, sEdge);
+      ClimbMinCutIndex(index, k, t, tValue, tEdge);
+    }
+  }
+  if (s != t) {
+    ClimbMinCutIndex(index, 0, s, sValue, sEdge);
+    ClimbMinCutIndex(index, 0, t, tValue, tEdge);
+  }
+  sourceBelow = sValue <= tValue;
+  edge = sourceBelow ? sEdge : tEdge;
+  return sourceBelow ? sValue : tValue;
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+SEXP GomoryHuIndexRunner(std::vector<int> arcSources,
+                         std::vector<int> arcTargets,
+                         std::vector<double> arcWeights, int numNodes,
+                         int numThreads) {
+  Rcpp::XPtr<MinCutIndex> ptr(new MinCutIndex(), true);
+  if (IsIntegral(arcWeights)) {
+    BuildMinCutIndex<int>(*ptr, arcSources, arcTargets, arcWeights, numNodes,
+                          numThreads);
+  } else {
+    BuildMinCutIndex<double>(*ptr, arcSources, arcTargets, arcWeights,
+                             numNodes, numThreads);
+  }
+  return ptr;
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List GomoryHuQueryRunner(SEXP index, std::vector<int> sourceNodes,
+                               std::vector<int> destinationNodes, bool cuts) {
+  const MinCutIndex &mci = GetMinCutIndex(index);
+  int numNodes = mci.numNodes;
+  int numPairs = sourceNodes.size();
+  for (int i = 0; i < numPairs; ++i) {
+    if (sourceNodes[i] < 1 || sourceNodes[i] > numNodes ||
+        destinationNodes[i] < 1 || destinationNodes[i] > numNodes) {
+      Rcpp::stop("Node index given is out of range for the index.");
+    }
+    if (sourceNodes[i] == destinationNodes[i]) {
+      Rcpp::stop("The source and destination nodes must be different.");
+    }
+  }
+
+  std::vector<double> values(numPairs);
+  Rcpp::IntegerMatrix cutMatrix(cuts ? numPairs : 0, cuts ? numNodes : 0);
+  for (int i = 0; i < numPairs; ++i) {
+    int edge;
+    bool sourceBelow;
+    values[i] = QueryMinCutIndex(mci, sourceNodes[i] - 1,
+                                 destinationNodes[i] - 1, edge, sourceBelow);
+    if (cuts) {
+      // The source side is the edge's subtree if the source is in it, and
+      // the rest of the tree otherwise.
+      for (int v = 0; v < numNodes; ++v) {
+        bool below = mci.first[v] >= mci.first[edge] &&
+                     mci.first[v] <= mci.last[edge];
+        cutMatrix(i, v) = below == sourceBelow;
+      }
+    }
+  }
+  if (!cuts) {
+    return Rcpp::List::create(values, R_NilValue);
+  }
+  return Rcpp::List::create(values, cutMatrix);
+}
@@ -1,6 +1,8 @@
+#include "graph_handle.h"
 #include "lemon/hartmann_orlin_mmc.h"
 #include "lemon/howard_mmc.h"
 #include "lemon/karp_mmc.h"
+#include "value_type.h"
 #include <Rcpp.h>
 #include <iostream>
 #include <vector>
@@ -8,39 +10,24 @@
 using namespace lemon;
 using namespace std;
 
-//' @rdname lemon_runners
-// [[Rcpp::export]]
-Rcpp::List HowardMmcRunner(std::vector<int> arcSources,
-                           std::vector<int> arcTargets,
-                           std::vector<int> arcDistances, int numNodes) {
-  // Requires: Two std::vectors, arcSources and arcTargets, each of which take integers to index specific nodes and, as pairs, consitute arcs in our graph
-  //           One std::vector, arcDistances, which assigns for each arc an associated distance
-  //           Two ints, numNodes and startnode, which give us the number of nodes in the directed graph and the starting node for Bellman Ford
-  // Returns: One std::vector, which contains the minimum distances from the start node to each of the nodes, with "-1" used as a placeholder to indicates the target and source and disjoint
-  ListDigraph g;
-  std::vector<ListDigraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  ListDigraph::ArcMap<int> costs(g);
-  ListDigraph::NodeMap<int> dists(g);
-
-  std::vector<ListDigraph::Arc> arcs;
-
-  int NUM_ARCS = arcSources.size();
+// Finds a minimum mean cycle on `h` with the LEMON algorithm `MMC`
+// (HowardMmc, KarpMmc or HartmannOrlinMmc) and arc costs of type `Value`.
+template <template <typename, typename> class MMC, typename Value>
+inline Rcpp::List RunMinMeanCycle(const DigraphHandle &h,
+                                  const std::vector<double> &arcDistances) {
+  typedef DigraphHandle::Digraph Digraph;
+  const Digraph &g = h.g;
+  Digraph::ArcMap<Value> costs(g);
 
+  int NUM_ARCS = h.arcs.size();
   for (int i = 0; i < NUM_ARCS; ++i) {
-    ListDigraph::Arc a =
-        g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    arcs.push_back(a);
-    costs[arcs[i]] = arcDistances[i];
+    costs[h.arcs[i]] = arcDistances[i];
   }
 
-  Path<ListDigraph> finale;
+  Path<Digraph> finale;
 
-  HowardMmc<ListDigraph>(g, costs).cycle(finale).run();
-  std::vector<int> distances;
+  MMC<Digraph, Digraph::ArcMap<Value> >(g, costs).cycle(finale).run();
+  std::vector<Value> distances;
   std::vector<int> path_nodes;
   for (int i = 0; i < finale.length(); i++) {
     distances.push_back(costs[finale.nth(i)]);
@@ -49,84 +36,80 @@ Rcpp::List HowardMmcRunner(std::vector<int> arcSources,
   return Rcpp::List::create(distances, path_nodes);
 }
 
+// The MMC classes take a traits class as their third template argument;
+// these aliases let RunMinMeanCycle instantiate them.
+template <typename GR, typename CM> using HowardMmcAlg = HowardMmc<GR, CM>;
+template <typename GR, typename CM> using KarpMmcAlg = KarpMmc<GR, CM>;
+template <typename GR, typename CM>
+using HartmannOrlinMmcAlg = HartmannOrlinMmc<GR, CM>;
+
 //' @rdname lemon_runners
 // [[Rcpp::export]]
-Rcpp::List KarpMmcRunner(std::vector<int> arcSources,
-                         std::vector<int> arcTargets,
-                         std::vector<int> arcDistances, int numNodes) {
-  // Requires: Two std::vectors, arcSources and arcTargets, each of which take integers to index specific nodes and, as pairs, consitute arcs in our graph
-  //           One std::vector, arcDistances, which assigns for each arc an associated distance
-  //           Two ints, numNodes and startnode, which give us the number of nodes in the directed graph and the starting node for Bellman Ford
-  // Returns: One std::vector, which contains the minimum distances from the start node to each of the nodes, with "-1" used as a placeholder to indicates the target and source and disjoint
-  ListDigraph g;
-  std::vector<ListDigraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
+Rcpp::List HowardMmcRunner(std::vector<int> arcSources,
+                           std::vector<int> arcTargets,
+                           std::vector<double> arcDistances, int numNodes) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  if (IsIntegral(arcDistances)) {
+    return RunMinMeanCycle<HowardMmcAlg, int>(h, arcDistances);
   }
-  ListDigraph::ArcMap<int> costs(g);
-  ListDigraph::NodeMap<int> dists(g);
-
-  std::vector<ListDigraph::Arc> arcs;
-
-  int NUM_ARCS = arcSources.size();
+  return RunMinMeanCycle<HowardMmcAlg, double>(h, arcDistances);
+}
 
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    ListDigraph::Arc a =
-        g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    arcs.push_back(a);
-    costs[arcs[i]] = arcDistances[i];
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List HowardMmcGraphRunner(SEXP graph, std::vector<double> arcDistances) {
+  const DigraphHandle &h = GetDigraph(graph);
+  if (IsIntegral(arcDistances)) {
+    return RunMinMeanCycle<HowardMmcAlg, int>(h, arcDistances);
   }
+  return RunMinMeanCycle<HowardMmcAlg, double>(h, arcDistances);
+}
 
-  Path<ListDigraph> finale;
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List KarpMmcRunner(std::vector<int> arcSources,
+                         std::vector<int> arcTargets,
+                         std::vector<double> arcDistances, int numNodes) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  if (IsIntegral(arcDistances)) {
+    return RunMinMeanCycle<KarpMmcAlg, int>(h, arcDistances);
+  }
+  return RunMinMeanCycle<KarpMmcAlg, double>(h, arcDistances);
+}
 
-  KarpMmc<ListDigraph>(g, costs).cycle(finale).run();
-  std::vector<int> distances;
-  std::vector<int> path_nodes;
-  for (int i = 0; i < finale.length(); i++) {
-    distances.push_back(costs[finale.nth(i)]);
-    path_nodes.push_back(g.id(g.source(finale.nth(i))) + 1);
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List KarpMmcGraphRunner(SEXP graph, std::vector<double> arcDistances) {
+  const DigraphHandle &h = GetDigraph(graph);
+  if (IsIntegral(arcDistances)) {
+    return RunMinMeanCycle<KarpMmcAlg, int>(h, arcDistances);
   }
-  return Rcpp::List::create(distances, path_nodes);
+  return RunMinMeanCycle<KarpMmcAlg, double>(h, arcDistances);
 }
 
 //' @rdname lemon_runners
 // [[Rcpp::export]]
 Rcpp::List HartmannOrlinMmcRunner(std::vector<int> arcSources,
                                   std::vector<int> arcTargets,
-                                  std::vector<int> arcDistances, int numNodes) {
-  // Requires: Two std::vectors, arcSources and arcTargets, each of which take integers to index specific nodes and, as pairs, consitute arcs in our graph
-  //           One std::vector, arcDistances, which assigns for each arc an associated distance
-  //           Two ints, numNodes and startnode, which give us the number of nodes in the directed graph and the starting node for Bellman Ford
-  // Returns: One std::vector, which contains the minimum distances from the start node to each of the nodes, with "-1" used as a placeholder to indicates the target and source and disjoint
-  ListDigraph g;
-  std::vector<ListDigraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
+                                  std::vector<double> arcDistances,
+                                  int numNodes) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  if (IsIntegral(arcDistances)) {
+    return RunMinMeanCycle<HartmannOrlinMmcAlg, int>(h, arcDistances);
   }
-  ListDigraph::ArcMap<int> costs(g);
-  ListDigraph::NodeMap<int> dists(g);
-
-  std::vector<ListDigraph::Arc> arcs;
-
-  int NUM_ARCS = arcSources.size();
-
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    ListDigraph::Arc a =
-        g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    arcs.push_back(a);
-    costs[arcs[i]] = arcDistances[i];
-  }
-
-  Path<ListDigraph> finale;
+  return RunMinMeanCycle<HartmannOrlinMmcAlg, double>(h, arcDistances);
+}
 
-  HartmannOrlinMmc<ListDigraph>(g, costs).cycle(finale).run();
-  std::vector<int> distances;
-  std::vector<int> path_nodes;
-  for (int i = 0; i < finale.length(); i++) {
-    distances.push_back(costs[finale.nth(i)]);
-    path_nodes.push_back(g.id(g.source(finale.nth(i))) + 1);
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List HartmannOrlinMmcGraphRunner(SEXP graph,
+                                       std::vector<double> arcDistances) {
+  const DigraphHandle &h = GetDigraph(graph);
+  if (IsIntegral(arcDistances)) {
+    return RunMinMeanCycle<HartmannOrlinMmcAlg, int>(h, arcDistances);
   }
-  return Rcpp::List::create(distances, path_nodes);
+  return RunMinMeanCycle<HartmannOrlinMmcAlg, double>(h, arcDistances);
 }
@@ -1,3 +1,5 @@
+#include "graph_handle.h"
+#include "value_type.h"
 #include <Rcpp.h>
 #include <lemon/kruskal.h>
 #include <lemon/list_graph.h>
@@ -6,11 +8,13 @@
 
 using namespace lemon;
 
-//' @rdname lemon_runners
-// [[Rcpp::export]]
-Rcpp::List KruskalRunner(std::vector<int> arcSources,
-                         std::vector<int> arcTargets,
-                         std::vector<int> arcDistances, int numNodes) {
+// Finds a minimum spanning forest of the graph with arc costs of type
+// `Value` using Kruskal's algorithm.
+template <typename Value>
+inline Rcpp::List RunKruskal(const std::vector<int> &arcSources,
+                             const std::vector<int> &arcTargets,
+                             const std::vector<double> &arcDistances,
+                             int numNodes) {
   ListDigraph g;
 
   std::vector<ListDigraph::Node> nodes;
@@ -20,7 +24,7 @@ Rcpp::List KruskalRunner(std::vector<int> arcSources,
     nodes.push_back(n);
   }
   int NUM_ARCS = arcSources.size();
-  ListDigraph::ArcMap<int> dists(g);
+  ListDigraph::ArcMap<Value> dists(g);
   std::vector<ListDigraph::Arc> tree;
   std::vector<ListDigraph::Arc> arcs;
 
@@ -30,7 +34,7 @@ Rcpp::List KruskalRunner(std::vector<int> arcSources,
     arcs.push_back(a);
     dists[a] = arcDistances[i];
   }
-  int treeVal = kruskal(g, dists, std::back_inserter(tree));
+  Value treeVal = kruskal(g, dists, std::back_inserter(tree));
   std::vector<int> treeSources;
   std::vector<int> treeTargets;
   for (size_t i = 0; i < tree.size(); i++) {
@@ -42,38 +46,65 @@ Rcpp::List KruskalRunner(std::vector<int> arcSources,
 
 //' @rdname lemon_runners
 // [[Rcpp::export]]
-Rcpp::List MinCostArborescenceRunner(std::vector<int> arcSources,
-                                     std::vector<int> arcTargets,
-                                     std::vector<int> arcDistances,
-                                     int sourceNode, int numNodes) {
-  ListDigraph g;
-
-  std::vector<ListDigraph::Node> nodes;
-
-  for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
+Rcpp::List KruskalRunner(std::vector<int> arcSources,
+                         std::vector<int> arcTargets,
+                         std::vector<double> arcDistances, int numNodes) {
+  if (IsIntegral(arcDistances)) {
+    return RunKruskal<int>(arcSources, arcTargets, arcDistances, numNodes);
   }
-  int NUM_ARCS = arcSources.size();
-  ListDigraph::ArcMap<int> dists(g);
-  std::vector<ListDigraph::Arc> tree;
-  std::vector<ListDigraph::Arc> arcs;
+  return RunKruskal<double>(arcSources, arcTargets, arcDistances, numNodes);
+}
+
+// Finds a minimum cost arborescence rooted at sourceNode on `h` with arc
+// costs of type `Value`.
+template <typename Value>
+inline Rcpp::List
+RunMinCostArborescence(const DigraphHandle &h,
+                       const std::vector<double> &arcDistances,
+                       int sourceNode) {
+  typedef DigraphHandle::Digraph Digraph;
+  const Digraph &g = h.g;
+  int NUM_ARCS = h.arcs.size();
 
+  Digraph::ArcMap<Value> dists(g);
   for (int i = 0; i < NUM_ARCS; ++i) {
-    ListDigraph::Arc a =
-        g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    arcs.push_back(a);
-    dists[a] = arcDistances[i];
+    dists[h.arcs[i]] = arcDistances[i];
   }
-  ListDigraph::ArcMap<int> arbs(g);
-  int arbVal = minCostArborescence(g, dists, nodes[sourceNode - 1], arbs);
+  Digraph::ArcMap<int> arbs(g);
+  Value arbVal = minCostArborescence(g, dists, h.nodes[sourceNode - 1], arbs);
   std::vector<int> treeSources;
   std::vector<int> treeTargets;
   for (int i = 0; i < NUM_ARCS; i++) {
-    if (arbs[arcs[i]]) {
-      treeSources.push_back(g.id(g.source(arcs[i])) + 1);
-      treeTargets.push_back(g.id(g.target(arcs[i])) + 1);
+    if (arbs[h.arcs[i]]) {
+      treeSources.push_back(g.id(g.source(h.arcs[i])) + 1);
+      treeTargets.push_back(g.id(g.target(h.arcs[i])) + 1);
     }
   }
   return Rcpp::List::create(treeSources, treeTargets, arbVal);
 }
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List MinCostArborescenceRunner(std::vector<int> arcSources,
+                                     std::vector<int> arcTargets,
+                                     std::vector<double> arcDistances,
+                                     int sourceNode, int numNodes) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  if (IsIntegral(arcDistances)) {
+    return RunMinCostArborescence<int>(h, arcDistances, sourceNode);
+  }
+  return RunMinCostArborescence<double>(h, arcDistances, sourceNode);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List MinCostArborescenceGraphRunner(SEXP graph,
+                                          std::vector<double> arcDistances,
+                                          int sourceNode) {
+  const DigraphHandle &h = GetDigraph(graph);
+  if (IsIntegral(arcDistances)) {
+    return RunMinCostArborescence<int>(h, arcDistances, sourceNode);
+  }
+  return RunMinCostArborescence<double>(h, arcDistances, sourceNode);
+}
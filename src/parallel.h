@@ -0,0 +1,69 @@
+#ifndef RLEMON_PARALLEL_H
+#define RLEMON_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Number of worker threads to use for `numTasks` independent tasks when the
+// caller asked for `numThreads`. A value below 1 means "one per core".
+inline int NumWorkers(int numThreads, int numTasks) {
+  if (numThreads < 1) {
+    numThreads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  return std::max(1, std::min(numThreads, numTasks));
+}
+
+// Calls body(task, worker) for every task in [0, numTasks), spread over
+// NumWorkers(numThreads, numTasks) threads. Tasks are handed out one at a
+// time, so uneven tasks still balance; `worker` lies in [0, number of
+// workers) and can be used to index per-thread scratch space.
+//
+// The body runs outside the R main thread and so must not touch the R API
+// (no Rcpp vectors, no Rcpp::stop). If a body throws, the remaining tasks
+// are skipped and the first exception is rethrown here once all threads
+// have finished.
+template <typename Body>
+void ParallelFor(int numTasks, int numThreads, Body body) {
+  int numWorkers = NumWorkers(numThreads, numTasks);
+  if (numWorkers == 1) {
+    for (int task = 0; task < numTasks; ++task) {
+      body(task, 0);
+    }
+    return;
+  }
+
+  std::atomic<int> nextTask(0);
+  std::exception_ptr error;
+  std::mutex errorMutex;
+  auto work = [&](int worker) {
+    try {
+      for (int task = nextTask++; task < numTasks; task = nextTask++) {
+        body(task, worker);
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(errorMutex);
+      if (!error) {
+        error = std::current_exception();
+      }
+      nextTask = numTasks;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int worker = 1; worker < numWorkers; ++worker) {
+    threads.push_back(std::thread(work, worker));
+  }
+  work(0);
+  for (size_t i = 0; i < threads.size(); ++i) {
+    threads[i].join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+#endif // RLEMON_PARALLEL_H
@@ -0,0 +1,121 @@
+#ifndef RLEMON_PARALLEL_COMPONENTS_H
+#define RLEMON_PARALLEL_COMPONENTS_H
+
+#include "parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+// Labels the connected components of an undirected graph given as a list
+// of edges, with a union-find shared by several threads, without building
+// a graph.
+//
+// The edges are split into blocks which the threads unite concurrently.
+// The union-find is a flat array of parents, and every change to it is a
+// compare-and-swap: a root is linked below a smaller root, and finds
+// shorten their paths by path splitting, each node on the path being
+// pointed to its grandparent. A node's parent is therefore never larger
+// than the node, so concurrent changes cannot make a cycle, and a link only
+// succeeds while its node is still a root.
+//
+// The components are then numbered in the order LEMON's
+// connectedComponents() numbers them on a StaticDigraph, which visits the
+// nodes from the last to the first, so both give the same labels.
+class ParallelComponents {
+public:
+  // The graph has nodes 1 to numNodes, as passed from R, and the edges
+  // sources[i] - targets[i].
+  ParallelComponents(int numNodes, const std::vector<int> &sources,
+                     const std::vector<int> &targets, int numThreads)
+      : numNodes(numNodes), sources(sources), targets(targets),
+        numThreads(numThreads) {}
+
+  void run() {
+    std::vector<std::atomic<int> > parent(numNodes);
+    for (int n = 0; n < numNodes; ++n) {
+      parent[n].store(n, std::memory_order_relaxed);
+    }
+
+    long long numArcs = sources.size();
+    int numBlocks = (numArcs + BLOCK_ARCS - 1) / BLOCK_ARCS;
+    ParallelFor(numBlocks, numThreads, [&](int block, int) {
+      long long end = std::min(numArcs, (block + 1) * BLOCK_ARCS);
+      for (long long i = block * BLOCK_ARCS; i < end; ++i) {
+        Unite(parent, sources[i] - 1, targets[i] - 1);
+      }
+    });
+
+    std::vector<int> root(numNodes);
+    int numNodeBlocks = (numNodes + BLOCK_NODES - 1) / BLOCK_NODES;
+    ParallelFor(numNodeBlocks, numThreads, [&](int block, int) {
+      int end = std::min<long long>(numNodes, (block + 1) * BLOCK_NODES);
+      for (int n = block * BLOCK_NODES; n < end; ++n) {
+        root[n] = Find(parent, n);
+      }
+    });
+
+    // Roots are the smallest nodes of their components, so each is reached
+    // last in its own component and its label can be kept in its own slot
+    // of `label` until then.
+    label.assign(numNodes, -1);
+    componentCount = 0;
+    for (int n = numNodes - 1; n >= 0; --n) {
+      int &rootLabel = label[root[n]];
+      if (rootLabel == -1) {
+        rootLabel = componentCount++;
+      }
+      label[n] = rootLabel;
+    }
+  }
+
+  // The component of `node` (from 1 to numNodes); the components are
+  // numbered from 0.
+  int component(int node) const { return label[node - 1]; }
+  int componentNum() const { return componentCount; }
+
+private:
+  // Edges and nodes handed to a thread at a time.
+  static const long long BLOCK_ARCS = 1 << 16;
+  static const long long BLOCK_NODES = 1 << 16;
+
+  int numNodes;
+  const std::vector<int> &sources, &targets;
+  int numThreads;
+  std::vector<int> label;
+  int componentCount;
+
+  static int Find(std::vector<std::atomic<int> > &parent, int x) {
+    while (true) {
+      int p = parent[x].load(std::memory_order_relaxed);
+      if (p == x) {
+        return x;
+      }
+      int grandparent = parent[p].load(std::memory_order_relaxed);
+      if (grandparent != p) {
+        int expected = p;
+        parent[x].compare_exchange_weak(expected, grandparent,
+                                        std::memory_order_relaxed);
+      }
+      x = p;
+    }
+  }
+
+  static void Unite(std::vector<std::atomic<int> > &parent, int a, int b) {
+    while (true) {
+      a = Find(parent, a);
+      b = Find(parent, b);
+      if (a == b) {
+        return;
+      }
+      if (a < b) {
+        std::swap(a, b);
+      }
+      if (parent[a].compare_exchange_strong(a, b)) {
+        return;
+      }
+    }
+  }
+};
+
+#endif // RLEMON_PARALLEL_COMPONENTS_H
@@ -0,0 +1,171 @@
+#ifndef RLEMON_PARALLEL_GOMORY_HU_H
+#define RLEMON_PARALLEL_GOMORY_HU_H
+
+#include "parallel.h"
+
+#include <algorithm>
+#include <lemon/core.h>
+#include <lemon/preflow.h>
+#include <limits>
+#include <memory>
+#include <vector>
+
+// Builds the same Gomory-Hu tree as lemon::GomoryHu, spreading its n - 1
+// minimum cut computations over several threads.
+//
+// lemon::GomoryHu is Gusfield's algorithm: it visits the nodes in order and
+// cuts each one from its current tree parent, and each cut can re-parent
+// the nodes not visited yet. The cuts are therefore computed speculatively,
+// a window of upcoming nodes at a time, each against its parent as it is
+// when the window starts, by one Preflow per thread over the shared graph.
+// The cuts are then applied in order; a cut is only applied if the node's
+// parent has not changed since, and the first node whose parent has changed
+// starts the next window, where the cuts still valid are kept. The first
+// node of a window is always applied, so every window makes progress, and
+// the tree is identical to the one built sequentially.
+template <typename GR, typename CAP> class ParallelGomoryHu {
+public:
+  typedef GR Graph;
+  typedef CAP Capacity;
+  typedef typename Capacity::Value Value;
+  typedef typename Graph::Node Node;
+  typedef typename Graph::NodeIt NodeIt;
+
+  ParallelGomoryHu(const Graph &graph, const Capacity &capacity,
+                   int numThreads)
+      : graph(graph), capacity(capacity), numThreads(numThreads) {}
+
+  void run() {
+    nodes.clear();
+    for (NodeIt n(graph); n != lemon::INVALID; ++n) {
+      nodes.push_back(n);
+    }
+    int numNodes = nodes.size();
+    index.assign(graph.maxNodeId() + 1, -1);
+    for (int i = 0; i < numNodes; ++i) {
+      index[graph.id(nodes[i])] = i;
+    }
+    pred.assign(numNodes, 0);
+    weight.assign(numNodes, 0);
+    order.assign(numNodes, -1);
+    if (numNodes == 0) {
+      return;
+    }
+    pred[0] = -1;
+    weight[0] = std::numeric_limits<Value>::max();
+
+    int numWorkers = NumWorkers(numThreads, numNodes - 1);
+    int window = numWorkers == 1 ? 1 : WINDOW_PER_WORKER * numWorkers;
+    std::vector<std::unique_ptr<Flow> > workers(numWorkers);
+    for (int w = 0; w < numWorkers; ++w) {
+      workers[w].reset(new Flow(graph, capacity, nodes[0], nodes[0]));
+    }
+    // The cut of each node in the window: the parent it was computed
+    // against, its value and the source side.
+    std::vector<int> slotOf(numNodes, -1), cutTarget(window);
+    std::vector<Value> cutValue(window);
+    std::vector<std::vector<char> > cutSide(window,
+                                            std::vector<char>(numNodes));
+    std::vector<int> freeSlots;
+    for (int k = window - 1; k >= 0; --k) {
+      freeSlots.push_back(k);
+    }
+
+    for (int next = 1; next < numNodes;) {
+      int end = std::min(numNodes, next + window);
+      std::vector<int> tasks;
+      for (int n = next; n < end; ++n) {
+        if (slotOf[n] == -1) {
+          slotOf[n] = freeSlots.back();
+          freeSlots.pop_back();
+        } else if (cutTarget[slotOf[n]] == pred[n]) {
+          continue;
+        }
+        cutTarget[slotOf[n]] = pred[n];
+        tasks.push_back(n);
+      }
+
+      ParallelFor(tasks.size(), numWorkers, [&](int task, int worker) {
+        int n = tasks[task], slot = slotOf[n];
+        Flow &flow = *workers[worker];
+        flow.source(nodes[n]);
+        flow.target(nodes[cutTarget[slot]]);
+        flow.runMinCut();
+        cutValue[slot] = flow.flowValue();
+        std::vector<char> &side = cutSide[slot];
+        for (int i = 0; i < numNodes; ++i) {
+          side[i] = flow.minCut(nodes[i]);
+        }
+      });
+
+      for (; next < end; ++next) {
+        int slot = slotOf[next];
+        if (cutTarget[slot] != pred[next]) {
+          break;
+        }
+        Apply(next, cutTarget[slot], cutValue[slot], cutSide[slot]);
+        slotOf[next] = -1;
+        freeSlots.push_back(slot);
+      }
+    }
+
+    order[0] = 0;
+    int position = 1;
+    std::vector<int> stack;
+    for (int n = 0; n < numNodes; ++n) {
+      for (int m = n; order[m] == -1; m = pred[m]) {
+        stack.push_back(m);
+      }
+      while (!stack.empty()) {
+        order[stack.back()] = position++;
+        stack.pop_back();
+      }
+    }
+  }
+
+  // As in lemon::GomoryHu; predNode() of the root is INVALID.
+  Node predNode(const Node &node) const {
+    int p = pred[index[graph.id(node)]];
+    return p == -1 ? Node(lemon::INVALID) : nodes[p];
+  }
+  Value predValue(const Node &node) const {
+    return weight[index[graph.id(node)]];
+  }
+  int rootDist(const Node &node) const {
+    return order[index[graph.id(node)]];
+  }
+
+private:
+  typedef lemon::Preflow<Graph, Capacity> Flow;
+
+  // Upcoming nodes cut speculatively per thread in each window.
+  static const int WINDOW_PER_WORKER = 4;
+
+  const Graph &graph;
+  const Capacity &capacity;
+  int numThreads;
+  // The tree, by position of the nodes in NodeIt order; the first node is
+  // the root.
+  std::vector<Node> nodes;
+  std::vector<int> index, pred, order;
+  std::vector<Value> weight;
+
+  // Gusfield's update after cutting node n from its parent p.
+  void Apply(int n, int p, Value value, const std::vector<char> &side) {
+    weight[n] = value;
+    int numNodes = nodes.size();
+    for (int m = 0; m < numNodes; ++m) {
+      if (m != n && side[m] && pred[m] == p) {
+        pred[m] = n;
+      }
+    }
+    if (pred[p] != -1 && side[pred[p]]) {
+      pred[n] = pred[p];
+      pred[p] = n;
+      weight[n] = weight[p];
+      weight[p] = value;
+    }
+  }
+};
+
+#endif // RLEMON_PARALLEL_GOMORY_HU_H
@@ -0,0 +1,301 @@
+#ifndef RLEMON_PARALLEL_PREFLOW_H
+#define RLEMON_PARALLEL_PREFLOW_H
+
+#include "graph_handle.h"
+#include "parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <lemon/tolerance.h>
+#include <vector>
+
+// A push-relabel maximum flow algorithm whose active nodes are discharged
+// concurrently, in synchronous rounds (Goldberg and Tarjan's parallel
+// push-relabel).
+//
+// In each round every active node first pushes along its admissible arcs,
+// judged by the labels from the start of the round, and then relabels if it
+// still has excess. An arc is only admissible from its higher labelled end,
+// so no arc is pushed on from both ends in the same round; each node owns
+// its own excess, and the excess it receives is summed atomically and only
+// added at the end of the round. Relabels read the labels from the start of
+// the round too, which keeps the labelling valid when neighbours relabel
+// together. Every so often the labels are recomputed exactly by a parallel
+// breadth-first search from the sink (global relabelling), which also
+// retires the nodes that can no longer reach it.
+//
+// The first phase finds a maximum preflow, and with it the minimum cut. The
+// second sends the excess left on the source side of the cut back to the
+// source, by the same rounds with the source as the sink.
+template <typename Value> class ParallelPreflow {
+public:
+  // `capacities` is indexed by the arc ids of `h.g`.
+  ParallelPreflow(const DigraphHandle &h, const std::vector<Value> &capacities,
+                  int numThreads)
+      : numNodes(h.nodes.size()), numArcs(h.arcs.size()),
+        numThreads(numThreads), cap(capacities), flows(numArcs, 0),
+        excess(numNodes, 0), label(numNodes, 0), newLabel(numNodes, 0),
+        allowed(numNodes, 1), added(numNodes), queued(numNodes),
+        bfsLabel(numNodes), buffers(NumWorkers(numThreads, INT_MAX)) {
+    typedef DigraphHandle::Digraph Digraph;
+    const Digraph &g = h.g;
+    adjFirst.assign(numNodes + 1, 0);
+    for (int v = 0; v < numNodes; ++v) {
+      Digraph::Node node = g.node(v);
+      for (Digraph::OutArcIt a(g, node); a != INVALID; ++a) {
+        adjArc.push_back(g.id(a));
+        adjNode.push_back(g.id(g.target(a)));
+        adjForward.push_back(1);
+      }
+      for (Digraph::InArcIt a(g, node); a != INVALID; ++a) {
+        adjArc.push_back(g.id(a));
+        adjNode.push_back(g.id(g.source(a)));
+        adjForward.push_back(0);
+      }
+      adjFirst[v + 1] = adjArc.size();
+    }
+    for (int v = 0; v < numNodes; ++v) {
+      added[v] = 0;
+      queued[v] = 0;
+    }
+  }
+
+  // Finds a maximum flow from `source` to `target` (0-indexed, distinct).
+  void run(int source, int target) {
+    // First phase: a maximum preflow into `target`. The source is left out
+    // of the search, so its label stays at numNodes.
+    std::fill(allowed.begin(), allowed.end(), 1);
+    allowed[source] = 0;
+    GlobalRelabel(target);
+    for (int j = adjFirst[source]; j < adjFirst[source + 1]; ++j) {
+      int w = adjNode[j];
+      if (adjForward[j] && w != source) {
+        flows[adjArc[j]] = cap[adjArc[j]];
+        excess[w] += cap[adjArc[j]];
+        excess[source] -= cap[adjArc[j]];
+      }
+    }
+    Discharge(target, ActiveNodes(source, target));
+    flowValue = excess[target];
+
+    // The nodes which can no longer reach the target form the source side
+    // of a minimum cut.
+    GlobalRelabel(target);
+    inCut.assign(numNodes, 0);
+    for (int v = 0; v < numNodes; ++v) {
+      inCut[v] = v == source || label[v] == numNodes;
+    }
+
+    // Second phase: return the remaining excess to the source, within the
+    // source side of the cut.
+    for (int v = 0; v < numNodes; ++v) {
+      allowed[v] = inCut[v];
+    }
+    GlobalRelabel(source);
+    Discharge(source, ActiveNodes(source, source));
+  }
+
+  Value value() const { return flowValue; }
+  Value flow(int arc) const { return flows[arc]; }
+  bool minCut(int node) const { return inCut[node]; }
+
+private:
+  // Number of active nodes handled by one parallel task.
+  static const int CHUNK = 256;
+
+  int numNodes, numArcs, numThreads;
+  // The arcs at each node in both directions, in compressed form: entries
+  // adjFirst[v] up to adjFirst[v + 1] are the arcs leaving v (adjForward
+  // set) and entering v, with the node at their other end.
+  std::vector<int> adjFirst, adjArc, adjNode;
+  std::vector<char> adjForward;
+
+  std::vector<Value> cap, flows, excess;
+  std::vector<int> label, newLabel;
+  std::vector<char> allowed, inCut;
+  std::vector<std::atomic<Value> > added;
+  std::vector<std::atomic<char> > queued;
+  std::vector<std::atomic<int> > bfsLabel;
+  std::vector<std::vector<int> > buffers;
+  Tolerance<Value> tolerance;
+  Value flowValue;
+
+  // Residual capacity of adjacency entry j, away from its node.
+  Value Residual(int j) const {
+    int a = adjArc[j];
+    return adjForward[j] ? cap[a] - flows[a] : flows[a];
+  }
+
+  // Residual capacity of adjacency entry j, towards its node.
+  Value ResidualTowards(int j) const {
+    int a = adjArc[j];
+    return adjForward[j] ? flows[a] : cap[a] - flows[a];
+  }
+
+  static void AtomicAdd(std::atomic<Value> &x, Value delta) {
+    Value old = x.load(std::memory_order_relaxed);
+    while (!x.compare_exchange_weak(old, old + delta,
+                                    std::memory_order_relaxed)) {
+    }
+  }
+
+  // Calls body(v, worker) for each node in `nodes`, in parallel chunks.
+  template <typename Body>
+  void ForNodes(const std::vector<int> &nodes, Body body) {
+    int size = nodes.size();
+    int numTasks = (size + CHUNK - 1) / CHUNK;
+    ParallelFor(numTasks, numThreads, [&](int task, int worker) {
+      int end = std::min(size, (task + 1) * CHUNK);
+      for (int k = task * CHUNK; k < end; ++k) {
+        body(nodes[k], worker);
+      }
+    });
+  }
+
+  // Moves the contents of the per-worker buffers into `nodes`.
+  void Gather(std::vector<int> &nodes) {
+    nodes.clear();
+    for (size_t i = 0; i < buffers.size(); ++i) {
+      nodes.insert(nodes.end(), buffers[i].begin(), buffers[i].end());
+      buffers[i].clear();
+    }
+  }
+
+  std::vector<int> ActiveNodes(int source, int sink) const {
+    std::vector<int> active;
+    for (int v = 0; v < numNodes; ++v) {
+      if (v != source && v != sink && allowed[v] &&
+          tolerance.positive(excess[v]) && label[v] < numNodes) {
+        active.push_back(v);
+      }
+    }
+    return active;
+  }
+
+  // Sets each allowed node's label to its distance to `sink` in the
+  // residual graph, or numNodes if it cannot reach it.
+  void GlobalRelabel(int sink) {
+    for (int v = 0; v < numNodes; ++v) {
+      bfsLabel[v] = numNodes;
+    }
+    bfsLabel[sink] = 0;
+    std::vector<int> frontier(1, sink);
+    for (int level = 1; !frontier.empty(); ++level) {
+      ForNodes(frontier, [&](int x, int worker) {
+        for (int j = adjFirst[x]; j < adjFirst[x + 1]; ++j) {
+          int u = adjNode[j];
+          if (!allowed[u] || !tolerance.positive(ResidualTowards(j))) {
+            continue;
+          }
+          int unvisited = numNodes;
+          if (bfsLabel[u].compare_exchange_strong(unvisited, level)) {
+            buffers[worker].push_back(u);
+          }
+        }
+      });
+      Gather(frontier);
+    }
+    for (int v = 0; v < numNodes; ++v) {
+      label[v] = bfsLabel[v];
+    }
+  }
+
+  // Runs push-relabel rounds until no node in `active` (or reached from
+  // it) has excess left that can reach `sink`.
+  void Discharge(int sink, std::vector<int> active) {
+    const long long GLOBAL_RELABEL_WORK = 6LL * numNodes + numArcs / 2;
+    std::vector<long long> work(buffers.size(), 0);
+    std::vector<int> received;
+
+    while (!active.empty()) {
+      // Push along admissible arcs.
+      ForNodes(active, [&](int v, int worker) {
+        Value e = excess[v];
+        int level = label[v];
+        for (int j = adjFirst[v]; j < adjFirst[v + 1]; ++j) {
+          if (!tolerance.positive(e)) {
+            break;
+          }
+          int w = adjNode[j];
+          if (!allowed[w] || label[w] + 1 != level) {
+            continue;
+          }
+          Value rem = Residual(j);
+          if (!tolerance.positive(rem)) {
+            continue;
+          }
+          Value delta = std::min(rem, e);
+          if (adjForward[j]) {
+            flows[adjArc[j]] += delta;
+          } else {
+            flows[adjArc[j]] -= delta;
+          }
+          e -= delta;
+          AtomicAdd(added[w], delta);
+          if (queued[w].exchange(1) == 0) {
+            buffers[worker].push_back(w);
+          }
+        }
+        excess[v] = e;
+      });
+      Gather(received);
+
+      // Relabel the nodes with excess left, all of whose admissible arcs
+      // are now saturated.
+      ForNodes(active, [&](int v, int worker) {
+        newLabel[v] = label[v];
+        if (!tolerance.positive(excess[v])) {
+          return;
+        }
+        int level = numNodes;
+        for (int j = adjFirst[v]; j < adjFirst[v + 1]; ++j) {
+          int w = adjNode[j];
+          if (allowed[w] && label[w] + 1 < level &&
+              tolerance.positive(Residual(j))) {
+            level = label[w] + 1;
+          }
+        }
+        newLabel[v] = level;
+        work[worker] += adjFirst[v + 1] - adjFirst[v] + 1;
+      });
+      ForNodes(active, [&](int v, int) { label[v] = newLabel[v]; });
+      ForNodes(received, [&](int w, int) {
+        excess[w] += added[w].exchange(0);
+      });
+
+      // The next active nodes: those still active, and those which have
+      // just received excess.
+      ForNodes(active, [&](int v, int worker) {
+        if (!queued[v] && tolerance.positive(excess[v]) &&
+            label[v] < numNodes) {
+          buffers[worker].push_back(v);
+        }
+      });
+      ForNodes(received, [&](int w, int worker) {
+        queued[w] = 0;
+        if (w != sink && tolerance.positive(excess[w]) &&
+            label[w] < numNodes) {
+          buffers[worker].push_back(w);
+        }
+      });
+      Gather(active);
+
+      long long totalWork = 0;
+      for (size_t i = 0; i < work.size(); ++i) {
+        totalWork += work[i];
+      }
+      if (totalWork > GLOBAL_RELABEL_WORK) {
+        std::fill(work.begin(), work.end(), 0);
+        GlobalRelabel(sink);
+        active.erase(std::remove_if(active.begin(), active.end(),
+                                    [&](int v) {
+                                      return label[v] >= numNodes;
+                                    }),
+                     active.end());
+      }
+    }
+  }
+};
+
+#endif // RLEMON_PARALLEL_PREFLOW_H
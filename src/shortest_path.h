@@ -1,46 +1,56 @@
+#include "graph_handle.h"
+#include "lemon/adaptors.h"
 #include "lemon/bellman_ford.h"
+#include "lemon/bin_heap.h"
+#include "lemon/binomial_heap.h"
+#include "lemon/bucket_heap.h"
+#include "lemon/dheap.h"
 #include "lemon/dijkstra.h"
+#include "lemon/dim2.h"
+#include "lemon/fib_heap.h"
 #include "lemon/list_graph.h"
+#include "lemon/pairing_heap.h"
+#include "lemon/quad_heap.h"
+#include "lemon/radix_heap.h"
 #include "lemon/suurballe.h"
+#include "parallel.h"
+#include "value_type.h"
 
 #include <Rcpp.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 typedef int Value;
 
+// Largest distance bound for which the "Auto" heap of the Dijkstra runners
+// is a BucketHeap; see ChooseDijkstraHeap.
+const long long BUCKET_HEAP_LIMIT = 1 << 24;
+
 using namespace lemon;
 using namespace std;
 
-//' @rdname lemon_runners
-// [[Rcpp::export]]
-Rcpp::List SuurballeRunner(std::vector<int> arcSources,
-                           std::vector<int> arcTargets,
-                           std::vector<int> arcDistances, int numNodes,
-                           int startNode, int endNode) {
-  ListDigraph g;
-  std::vector<ListDigraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
-  }
-  ListDigraph::ArcMap<int> costs(g);
-  ListDigraph::NodeMap<int> dists(g);
-
-  std::vector<ListDigraph::Arc> arcs;
-
-  int NUM_ARCS = arcSources.size();
+// Runs Suurballe's algorithm between startNode and endNode on `h`.
+template <typename Value>
+inline Rcpp::List RunSuurballe(const DigraphHandle &h,
+                               const std::vector<double> &arcDistances,
+                               int startNode, int endNode) {
+  typedef DigraphHandle::Digraph Digraph;
+  const Digraph &g = h.g;
+  Digraph::ArcMap<Value> costs(g);
 
+  int NUM_ARCS = h.arcs.size();
   for (int i = 0; i < NUM_ARCS; ++i) {
-    ListDigraph::Arc a =
-        g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-
-    arcs.push_back(a);
-    costs[arcs[i]] = arcDistances[i];
+    costs[h.arcs[i]] = arcDistances[i];
   }
 
-  Suurballe<ListDigraph, DigraphExtender<ListDigraphBase>::ArcMap<int> > s(
-      g, costs);
-  int NUM_PATHS = s.run(nodes[startNode - 1], nodes[endNode - 1], NUM_ARCS);
+  Suurballe<Digraph, Digraph::ArcMap<Value> > s(g, costs);
+  int NUM_PATHS =
+      s.run(h.nodes[startNode - 1], h.nodes[endNode - 1], NUM_ARCS);
 
   std::vector<int> temp;
   std::vector<std::vector<int> > paths(NUM_PATHS, temp);
@@ -60,79 +70,890 @@ Rcpp::List SuurballeRunner(std::vector<int> arcSources,
   return Rcpp::List::create(NUM_PATHS, paths);
 }
 
-//' @rdname lemon_runners
-// [[Rcpp::export]]
-Rcpp::List DijkstraRunner(std::vector<int> arcSources,
-                          std::vector<int> arcTargets,
-                          std::vector<int> arcDistances, int numNodes,
-                          int startNode) {
-  ListDigraph g;
-  std::vector<ListDigraph::Node> nodes;
+// Runs Dijkstra's algorithm from startNode on `h` with arc distances of type
+// `Value`, using `Heap` as its priority queue.
+template <typename Value, typename Heap>
+inline Rcpp::List RunDijkstraHeap(const DigraphHandle &h,
+                                  const std::vector<double> &arcDistances,
+                                  int startNode) {
+  typedef DigraphHandle::Digraph Digraph;
+  typedef typename Dijkstra<Digraph, Digraph::ArcMap<Value> >::template
+      SetStandardHeap<Heap>::Create DijkstraAlg;
+  const Digraph &g = h.g;
+  Digraph::ArcMap<Value> costs(g);
+
+  int NUM_ARCS = h.arcs.size();
+  for (int i = 0; i < NUM_ARCS; ++i) {
+    costs[h.arcs[i]] = arcDistances[i];
+  }
+
+  DijkstraAlg bf(g, costs);
+  bf.run(h.nodes[startNode - 1]);
+  std::vector<Value> distances;
+  std::vector<int> predecessors;
+  int numNodes = h.nodes.size();
+  for (int i = 0; i < numNodes; i++) {
+    distances.push_back(bf.dist(h.nodes[i]));
+    predecessors.push_back(g.id(bf.predNode(h.nodes[i])) + 1);
+  }
+  return Rcpp::List::create(distances, predecessors);
+}
+
+// Runs Dijkstra's algorithm from each of startNodes on `h`, spreading the
+// sources over numThreads threads. Each worker owns its own Dijkstra object
+// (and so its own heap and maps) and reuses it for every source it is given;
+// the graph and the cost map are shared read-only. Row i of the returned
+// matrices holds the result for startNodes[i], laid out as in RunDijkstra.
+// The predecessor matrix is only filled when `predecessors` is true.
+template <typename Value, typename Heap>
+inline Rcpp::List RunDijkstraBatchHeap(const DigraphHandle &h,
+                                       const std::vector<double> &arcDistances,
+                                       const std::vector<int> &startNodes,
+                                       bool predecessors, int numThreads) {
+  typedef DigraphHandle::Digraph Digraph;
+  typedef typename Dijkstra<Digraph, Digraph::ArcMap<Value> >::template
+      SetStandardHeap<Heap>::Create DijkstraAlg;
+  const Digraph &g = h.g;
+  Digraph::ArcMap<Value> costs(g);
+
+  int NUM_ARCS = h.arcs.size();
+  for (int i = 0; i < NUM_ARCS; ++i) {
+    costs[h.arcs[i]] = arcDistances[i];
+  }
+
+  int numSources = startNodes.size();
+  int numNodes = h.nodes.size();
+  int numWorkers = NumWorkers(numThreads, numSources);
+  std::vector<std::unique_ptr<DijkstraAlg> > workers(numWorkers);
+  for (int w = 0; w < numWorkers; ++w) {
+    workers[w].reset(new DijkstraAlg(g, costs));
+  }
+
+  // Column-major sources x nodes, as R stores matrices.
+  std::vector<Value> distances((size_t)numSources * numNodes);
+  std::vector<int> preds(predecessors ? distances.size() : 0);
+  ParallelFor(numSources, numWorkers, [&](int task, int worker) {
+    DijkstraAlg &alg = *workers[worker];
+    alg.run(h.nodes[startNodes[task] - 1]);
+    for (int i = 0; i < numNodes; ++i) {
+      size_t k = (size_t)i * numSources + task;
+      // The distance map is reused between runs, so unreached nodes are
+      // reported as 0 explicitly, matching a freshly built RunDijkstra.
+      distances[k] = alg.reached(h.nodes[i]) ? alg.dist(h.nodes[i]) : 0;
+      if (predecessors) {
+        preds[k] = g.id(alg.predNode(h.nodes[i])) + 1;
+      }
+    }
+  });
+
+  Rcpp::Matrix<Rcpp::traits::r_sexptype_traits<Value>::rtype> distMatrix(
+      numSources, numNodes);
+  std::copy(distances.begin(), distances.end(), distMatrix.begin());
+  if (!predecessors) {
+    return Rcpp::List::create(distMatrix, R_NilValue);
+  }
+  Rcpp::IntegerMatrix predMatrix(numSources, numNodes);
+  std::copy(preds.begin(), preds.end(), predMatrix.begin());
+  return Rcpp::List::create(distMatrix, predMatrix);
+}
+
+// Resolves the `heap` argument of the Dijkstra runners. A BucketHeap keeps a
+// bucket per distance value (Dial's algorithm), so "Auto" picks it when no
+// shortest path can be longer than BUCKET_HEAP_LIMIT, which also caps its
+// memory, and a BinHeap otherwise; a RadixHeap was not faster than a BinHeap
+// on larger distances. RadixHeap and BucketHeap require non-negative integer
+// distances, so they are never picked for, and cannot be asked for with,
+// other ones.
+inline std::string ChooseDijkstraHeap(const DigraphHandle &h,
+                                      const std::vector<double> &arcDistances,
+                                      const std::string &heap) {
+  double minDist = 0, maxDist = 0;
+  for (size_t i = 0; i < arcDistances.size(); ++i) {
+    minDist = std::min(minDist, arcDistances[i]);
+    maxDist = std::max(maxDist, arcDistances[i]);
+  }
+  bool integerHeap = minDist >= 0 && IsIntegral(arcDistances);
+  if (heap == "RadixHeap" || heap == "BucketHeap") {
+    if (!integerHeap) {
+      Rcpp::stop("The " + heap +
+                 " requires non-negative integer arc distances.");
+    }
+    return heap;
+  }
+  if (heap != "Auto") {
+    return heap;
+  }
+  // Every shortest path has at most numNodes - 1 arcs.
+  double numNodes = h.nodes.size();
+  if (integerHeap &&
+      maxDist * std::max(numNodes - 1, 0.0) <= BUCKET_HEAP_LIMIT) {
+    return "BucketHeap";
+  }
+  return "BinHeap";
+}
+
+// Runs Dijkstra with the comparison-based heap named by `heap` and arc
+// distances of type `Value`.
+template <typename Value>
+inline Rcpp::List RunDijkstraValue(const DigraphHandle &h,
+                                   const std::vector<double> &arcDistances,
+                                   int startNode, const std::string &heap) {
+  typedef DigraphHandle::Digraph::NodeMap<int> CrossRef;
+  if (heap == "BinHeap") {
+    return RunDijkstraHeap<Value, BinHeap<Value, CrossRef> >(h, arcDistances,
+                                                             startNode);
+  } else if (heap == "QuadHeap") {
+    return RunDijkstraHeap<Value, QuadHeap<Value, CrossRef> >(
+        h, arcDistances, startNode);
+  } else if (heap == "DHeap") {
+    return RunDijkstraHeap<Value, DHeap<Value, CrossRef> >(h, arcDistances,
+                                                           startNode);
+  } else if (heap == "FibHeap") {
+    return RunDijkstraHeap<Value, FibHeap<Value, CrossRef> >(h, arcDistances,
+                                                             startNode);
+  } else if (heap == "PairingHeap") {
+    return RunDijkstraHeap<Value, PairingHeap<Value, CrossRef> >(
+        h, arcDistances, startNode);
+  } else if (heap == "BinomialHeap") {
+    return RunDijkstraHeap<Value, BinomialHeap<Value, CrossRef> >(
+        h, arcDistances, startNode);
+  }
+  Rcpp::stop("Invalid heap.");
+}
+
+// Runs RunDijkstraHeap with the heap named by `heap`, on int distances when
+// they are all integers and on double distances otherwise.
+inline Rcpp::List RunDijkstra(const DigraphHandle &h,
+                              const std::vector<double> &arcDistances,
+                              int startNode,
+                              const std::string &heap = "BinHeap") {
+  typedef DigraphHandle::Digraph::NodeMap<int> CrossRef;
+  std::string name = ChooseDijkstraHeap(h, arcDistances, heap);
+  if (name == "RadixHeap") {
+    return RunDijkstraHeap<int, RadixHeap<CrossRef> >(h, arcDistances,
+                                                      startNode);
+  } else if (name == "BucketHeap") {
+    return RunDijkstraHeap<int, BucketHeap<CrossRef> >(h, arcDistances,
+                                                       startNode);
+  } else if (IsIntegral(arcDistances)) {
+    return RunDijkstraValue<int>(h, arcDistances, startNode, name);
+  }
+  return RunDijkstraValue<double>(h, arcDistances, startNode, name);
+}
+
+// As RunDijkstraValue, for RunDijkstraBatchHeap.
+template <typename Value>
+inline Rcpp::List RunDijkstraBatchValue(const DigraphHandle &h,
+                                        const std::vector<double> &arcDistances,
+                                        const std::vector<int> &startNodes,
+                                        bool predecessors, int numThreads,
+                                        const std::string &heap) {
+  typedef DigraphHandle::Digraph::NodeMap<int> CrossRef;
+  if (heap == "BinHeap") {
+    return RunDijkstraBatchHeap<Value, BinHeap<Value, CrossRef> >(
+        h, arcDistances, startNodes, predecessors, numThreads);
+  } else if (heap == "QuadHeap") {
+    return RunDijkstraBatchHeap<Value, QuadHeap<Value, CrossRef> >(
+        h, arcDistances, startNodes, predecessors, numThreads);
+  } else if (heap == "DHeap") {
+    return RunDijkstraBatchHeap<Value, DHeap<Value, CrossRef> >(
+        h, arcDistances, startNodes, predecessors, numThreads);
+  } else if (heap == "FibHeap") {
+    return RunDijkstraBatchHeap<Value, FibHeap<Value, CrossRef> >(
+        h, arcDistances, startNodes, predecessors, numThreads);
+  } else if (heap == "PairingHeap") {
+    return RunDijkstraBatchHeap<Value, PairingHeap<Value, CrossRef> >(
+        h, arcDistances, startNodes, predecessors, numThreads);
+  } else if (heap == "BinomialHeap") {
+    return RunDijkstraBatchHeap<Value, BinomialHeap<Value, CrossRef> >(
+        h, arcDistances, startNodes, predecessors, numThreads);
+  }
+  Rcpp::stop("Invalid heap.");
+}
+
+// As RunDijkstra, for RunDijkstraBatchHeap.
+inline Rcpp::List RunDijkstraBatch(const DigraphHandle &h,
+                                   const std::vector<double> &arcDistances,
+                                   const std::vector<int> &startNodes,
+                                   bool predecessors, int numThreads,
+                                   const std::string &heap = "BinHeap") {
+  typedef DigraphHandle::Digraph::NodeMap<int> CrossRef;
+  std::string name = ChooseDijkstraHeap(h, arcDistances, heap);
+  if (name == "RadixHeap") {
+    return RunDijkstraBatchHeap<int, RadixHeap<CrossRef> >(
+        h, arcDistances, startNodes, predecessors, numThreads);
+  } else if (name == "BucketHeap") {
+    return RunDijkstraBatchHeap<int, BucketHeap<CrossRef> >(
+        h, arcDistances, startNodes, predecessors, numThreads);
+  } else if (IsIntegral(arcDistances)) {
+    return RunDijkstraBatchValue<int>(h, arcDistances, startNodes,
+                                      predecessors, numThreads, name);
+  }
+  return RunDijkstraBatchValue<double>(h, arcDistances, startNodes,
+                                       predecessors, numThreads, name);
+}
+
+// Result of a point-to-point query: the distance (Inf if endNode cannot be
+// reached) and the nodes of the path from startNode to endNode.
+inline Rcpp::List PathResult(bool found, double distance,
+                             const std::vector<int> &path) {
+  double dist = found ? distance : std::numeric_limits<double>::infinity();
+  return Rcpp::List::create(dist, path);
+}
+
+// Runs Dijkstra's algorithm from startNode on `h`, stopping as soon as
+// endNode is processed rather than settling the whole graph.
+template <typename Value>
+inline Rcpp::List RunDijkstraPath(const DigraphHandle &h,
+                                  const std::vector<double> &arcDistances,
+                                  int startNode, int endNode) {
+  typedef DigraphHandle::Digraph Digraph;
+  const Digraph &g = h.g;
+  Digraph::ArcMap<Value> costs(g);
+
+  int NUM_ARCS = h.arcs.size();
+  for (int i = 0; i < NUM_ARCS; ++i) {
+    costs[h.arcs[i]] = arcDistances[i];
+  }
+
+  Digraph::Node s = h.nodes[startNode - 1];
+  Digraph::Node t = h.nodes[endNode - 1];
+  Dijkstra<Digraph, Digraph::ArcMap<Value> > dijkstra(g, costs);
+  std::vector<int> path;
+  if (!dijkstra.run(s, t)) {
+    return PathResult(false, 0, path);
+  }
+  for (Digraph::Node v = t; v != INVALID; v = dijkstra.predNode(v)) {
+    path.push_back(g.id(v) + 1);
+  }
+  std::reverse(path.begin(), path.end());
+  return PathResult(true, dijkstra.dist(t), path);
+}
+
+// Bidirectional Dijkstra between startNode and endNode on `h`: a forward
+// search from startNode on the graph and a backward search from endNode on
+// its ReverseDigraph adaptor, alternating on whichever has the smaller next
+// distance. `best` tracks the shortest path seen through an arc joining the
+// two searches, and the search stops once the two queue minima add up to at
+// least `best`, since no undiscovered path can be shorter. Sums are kept as
+// doubles, which are exact for sums of int distances.
+template <typename Value>
+inline Rcpp::List
+RunBidirectionalDijkstra(const DigraphHandle &h,
+                         const std::vector<double> &arcDistances,
+                         int startNode, int endNode) {
+  typedef DigraphHandle::Digraph Digraph;
+  typedef ReverseDigraph<const Digraph> Reverse;
+  const Digraph &g = h.g;
+  Reverse rg(g);
+  Digraph::ArcMap<Value> costs(g);
+
+  int NUM_ARCS = h.arcs.size();
+  for (int i = 0; i < NUM_ARCS; ++i) {
+    costs[h.arcs[i]] = arcDistances[i];
+  }
+
+  Digraph::Node s = h.nodes[startNode - 1];
+  Digraph::Node t = h.nodes[endNode - 1];
+  Dijkstra<Digraph, Digraph::ArcMap<Value> > forward(g, costs);
+  Dijkstra<Reverse, Digraph::ArcMap<Value> > backward(rg, costs);
+  forward.init();
+  forward.addSource(s);
+  backward.init();
+  backward.addSource(t);
+
+  bool found = (s == t);
+  double best = 0;
+  Digraph::Arc meet = INVALID;
+  while (!forward.emptyQueue() && !backward.emptyQueue()) {
+    double topForward = forward.currentDist(forward.nextNode());
+    double topBackward = backward.currentDist(backward.nextNode());
+    if (found && topForward + topBackward >= best) {
+      break;
+    }
+    if (topForward <= topBackward) {
+      Digraph::Node u = forward.processNextNode();
+      for (Digraph::OutArcIt a(g, u); a != INVALID; ++a) {
+        Digraph::Node v = g.target(a);
+        if (backward.reached(v)) {
+          double d = (double)forward.dist(u) + costs[a] +
+                     backward.currentDist(v);
+          if (!found || d < best) {
+            found = true;
+            best = d;
+            meet = a;
+          }
+        }
+      }
+    } else {
+      Digraph::Node v = backward.processNextNode();
+      for (Digraph::InArcIt a(g, v); a != INVALID; ++a) {
+        Digraph::Node u = g.source(a);
+        if (forward.reached(u)) {
+          double d = (double)forward.currentDist(u) + costs[a] +
+                     backward.dist(v);
+          if (!found || d < best) {
+            found = true;
+            best = d;
+            meet = a;
+          }
+        }
+      }
+    }
+  }
+
+  std::vector<int> path;
+  if (!found) {
+    return PathResult(false, 0, path);
+  }
+  if (meet == INVALID) {
+    path.push_back(startNode);
+    return PathResult(true, 0, path);
+  }
+  for (Digraph::Node v = g.source(meet); v != INVALID;
+       v = forward.predNode(v)) {
+    path.push_back(g.id(v) + 1);
+  }
+  std::reverse(path.begin(), path.end());
+  for (Digraph::Node v = g.target(meet); v != INVALID;
+       v = backward.predNode(v)) {
+    path.push_back(g.id(v) + 1);
+  }
+  return PathResult(true, best, path);
+}
+
+// Lower bounds on the distance between two points, used as A* heuristics.
+// For "Haversine", x is the longitude and y the latitude in degrees, and the
+// great-circle distance is given in metres.
+inline double EuclideanHeuristic(const dim2::Point<double> &p,
+                                 const dim2::Point<double> &q) {
+  return std::sqrt((p - q).normSquare());
+}
+
+inline double ManhattanHeuristic(const dim2::Point<double> &p,
+                                 const dim2::Point<double> &q) {
+  return std::fabs(p.x - q.x) + std::fabs(p.y - q.y);
+}
+
+inline double HaversineHeuristic(const dim2::Point<double> &p,
+                                 const dim2::Point<double> &q) {
+  const double EARTH_RADIUS = 6371008.8;
+  const double RAD = 3.14159265358979323846 / 180;
+  double sinLat = std::sin((q.y - p.y) * RAD / 2);
+  double sinLon = std::sin((q.x - p.x) * RAD / 2);
+  double a = sinLat * sinLat +
+             std::cos(p.y * RAD) * std::cos(q.y * RAD) * sinLon * sinLon;
+  return 2 * EARTH_RADIUS * std::asin(std::min(1.0, std::sqrt(a)));
+}
+
+// Arc lengths for A*, reduced by a heuristic towards `target`: an arc (u, v)
+// of length c gets c - h(u) + h(v). Running plain Dijkstra on these lengths
+// is exactly A*, and it settles nodes in order of their distance plus their
+// estimated remaining distance. The heuristic is evaluated lazily, so only
+// arcs actually scanned pay for it. Rounding can push the length of an arc
+// that is tight for the heuristic slightly below zero, so lengths are
+// clamped at 0.
+template <typename Heuristic, typename CostMap>
+class AStarLengthMap {
+public:
+  typedef DigraphHandle::Digraph Digraph;
+  typedef Digraph::Arc Key;
+  typedef double Value;
+
+  AStarLengthMap(const Digraph &g, const CostMap &costs,
+                 const std::vector<dim2::Point<double> > &coords,
+                 Digraph::Node target, Heuristic heuristic)
+      : _g(g), _costs(costs), _coords(coords),
+        _target(coords[g.id(target)]), _heuristic(heuristic) {}
+
+  Value operator[](const Key &a) const {
+    double reduced = _costs[a] - estimate(_g.source(a)) +
+                     estimate(_g.target(a));
+    return std::max(0.0, reduced);
+  }
+
+  double estimate(Digraph::Node v) const {
+    return _heuristic(_coords[_g.id(v)], _target);
+  }
+
+private:
+  const Digraph &_g;
+  const CostMap &_costs;
+  const std::vector<dim2::Point<double> > &_coords;
+  dim2::Point<double> _target;
+  Heuristic _heuristic;
+};
+
+// Runs A* from startNode to endNode on `h`, as Dijkstra on the lengths given
+// by AStarLengthMap. The distance returned is the sum of the original arc
+// lengths along the path found, so it is exact. The path is only guaranteed
+// to be shortest if the heuristic never overestimates, i.e. every arc is at
+// least as long as the heuristic distance between its end points.
+template <typename Value, typename Heuristic>
+inline Rcpp::List RunAStarSearch(const DigraphHandle &h,
+                                 const std::vector<double> &arcDistances,
+                                 const std::vector<double> &nodeX,
+                                 const std::vector<double> &nodeY,
+                                 int startNode, int endNode,
+                                 Heuristic heuristic) {
+  typedef DigraphHandle::Digraph Digraph;
+  typedef AStarLengthMap<Heuristic, Digraph::ArcMap<Value> > LengthMap;
+  const Digraph &g = h.g;
+  Digraph::ArcMap<Value> costs(g);
+
+  int NUM_ARCS = h.arcs.size();
+  for (int i = 0; i < NUM_ARCS; ++i) {
+    costs[h.arcs[i]] = arcDistances[i];
+  }
+  int numNodes = h.nodes.size();
+  std::vector<dim2::Point<double> > coords(numNodes);
   for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
+    coords[g.id(h.nodes[i])] = dim2::Point<double>(nodeX[i], nodeY[i]);
   }
-  ListDigraph::ArcMap<int> costs(g);
-  ListDigraph::NodeMap<int> dists(g);
 
-  std::vector<ListDigraph::Arc> arcs;
+  Digraph::Node s = h.nodes[startNode - 1];
+  Digraph::Node t = h.nodes[endNode - 1];
+  LengthMap lengths(g, costs, coords, t, heuristic);
+  Dijkstra<Digraph, LengthMap> astar(g, lengths);
+  std::vector<int> path;
+  if (!astar.run(s, t)) {
+    return PathResult(false, 0, path);
+  }
+  double distance = 0;
+  for (Digraph::Node v = t; v != INVALID; v = astar.predNode(v)) {
+    path.push_back(g.id(v) + 1);
+    if (v != s) {
+      distance += costs[astar.predArc(v)];
+    }
+  }
+  std::reverse(path.begin(), path.end());
+  return PathResult(true, distance, path);
+}
 
-  int NUM_ARCS = arcSources.size();
+// Runs RunAStarSearch with the heuristic named by `heuristic`.
+template <typename Value>
+inline Rcpp::List RunAStar(const DigraphHandle &h,
+                           const std::vector<double> &arcDistances,
+                           const std::vector<double> &nodeX,
+                           const std::vector<double> &nodeY, int startNode,
+                           int endNode, const std::string &heuristic) {
+  if (heuristic == "Euclidean") {
+    return RunAStarSearch<Value>(h, arcDistances, nodeX, nodeY, startNode,
+                                 endNode, EuclideanHeuristic);
+  } else if (heuristic == "Manhattan") {
+    return RunAStarSearch<Value>(h, arcDistances, nodeX, nodeY, startNode,
+                                 endNode, ManhattanHeuristic);
+  } else if (heuristic == "Haversine") {
+    return RunAStarSearch<Value>(h, arcDistances, nodeX, nodeY, startNode,
+                                 endNode, HaversineHeuristic);
+  }
+  Rcpp::stop("Invalid heuristic.");
+}
+
+// Runs the Bellman-Ford algorithm from startNode on `h`.
+template <typename Value>
+inline Rcpp::List RunBellmanFord(const DigraphHandle &h,
+                                 const std::vector<double> &arcDistances,
+                                 int startNode) {
+  typedef DigraphHandle::Digraph Digraph;
+  const Digraph &g = h.g;
+  Digraph::ArcMap<Value> costs(g);
 
+  int NUM_ARCS = h.arcs.size();
   for (int i = 0; i < NUM_ARCS; ++i) {
-    ListDigraph::Arc a =
-        g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    arcs.push_back(a);
-    costs[arcs[i]] = arcDistances[i];
+    costs[h.arcs[i]] = arcDistances[i];
   }
 
-  Dijkstra<ListDigraph, DigraphExtender<ListDigraphBase>::ArcMap<int> > bf(
-      g, costs);
-  bf.run(nodes[startNode - 1]);
-  std::vector<int> distances;
+  BellmanFord<Digraph, Digraph::ArcMap<Value> > bf(g, costs);
+  bf.run(h.nodes[startNode - 1]);
+  std::vector<Value> distances;
   std::vector<int> predecessors;
+  int numNodes = h.nodes.size();
   for (int i = 0; i < numNodes; i++) {
-    distances.push_back(bf.dist(nodes[i]));
-    predecessors.push_back(g.id(bf.predNode(nodes[i])) + 1);
+    distances.push_back(bf.dist(h.nodes[i]));
+    predecessors.push_back(g.id(bf.predNode(h.nodes[i])) + 1);
   }
   return Rcpp::List::create(distances, predecessors);
 }
 
+// Johnson's algorithm for all-pairs shortest paths on `h`. A Bellman-Ford
+// run from a virtual source joined to every node by a zero-length arc gives
+// node potentials (starting every node as a source at distance 0 is
+// equivalent), which make all reduced arc costs non-negative. Dijkstra is
+// then run from every node on the reduced costs, spread over numThreads
+// threads as in RunDijkstraBatch. Entry (i, j) of the returned matrix is the
+// distance from node i to node j, or Inf if j cannot be reached from i.
+// Workers write straight into the R matrix, which is allocated up front.
+// Int distances are widened to long long, since the potentials and reduced
+// costs can exceed the range of the distances themselves.
+template <typename Value>
+inline Rcpp::NumericMatrix RunJohnson(const DigraphHandle &h,
+                                      const std::vector<double> &arcDistances,
+                                      int numThreads) {
+  typedef DigraphHandle::Digraph Digraph;
+  typedef typename std::conditional<std::is_integral<Value>::value,
+                                    long long, Value>::type LargeValue;
+  typedef Dijkstra<Digraph, Digraph::ArcMap<LargeValue> > DijkstraAlg;
+  const Digraph &g = h.g;
+  int numNodes = h.nodes.size();
+  int NUM_ARCS = h.arcs.size();
+
+  Digraph::ArcMap<LargeValue> costs(g);
+  for (int i = 0; i < NUM_ARCS; ++i) {
+    costs[h.arcs[i]] = arcDistances[i];
+  }
+
+  BellmanFord<Digraph, Digraph::ArcMap<LargeValue> > bf(g, costs);
+  bf.init(0);
+  for (int i = 0; i < numNodes; ++i) {
+    bf.addSource(h.nodes[i], 0);
+  }
+  if (!bf.checkedStart()) {
+    Rcpp::stop("The graph contains a negative cycle.");
+  }
+
+  std::vector<LargeValue> potential(numNodes);
+  for (int i = 0; i < numNodes; ++i) {
+    potential[i] = bf.dist(h.nodes[i]);
+  }
+  Digraph::ArcMap<LargeValue> reduced(g);
+  for (Digraph::ArcIt a(g); a != INVALID; ++a) {
+    reduced[a] = costs[a] + potential[g.id(g.source(a))] -
+                 potential[g.id(g.target(a))];
+  }
+
+  Rcpp::NumericMatrix distances(numNodes, numNodes);
+  double *out = distances.begin();
+  const double inf = std::numeric_limits<double>::infinity();
+
+  int numWorkers = NumWorkers(numThreads, numNodes);
+  std::vector<std::unique_ptr<DijkstraAlg> > workers(numWorkers);
+  for (int w = 0; w < numWorkers; ++w) {
+    workers[w].reset(new DijkstraAlg(g, reduced));
+  }
+  ParallelFor(numNodes, numWorkers, [&](int source, int worker) {
+    DijkstraAlg &alg = *workers[worker];
+    alg.run(h.nodes[source]);
+    for (int i = 0; i < numNodes; ++i) {
+      double &d = out[(size_t)i * numNodes + source];
+      if (alg.reached(h.nodes[i])) {
+        d = alg.dist(h.nodes[i]) - potential[source] + potential[i];
+      } else {
+        d = inf;
+      }
+    }
+  });
+  return distances;
+}
+
+// Relaxes the block of `d` (an n x n column-major distance matrix) with rows
+// [i0, i1) and columns [j0, j1) through the intermediate nodes [k0, k1).
+inline void FloydWarshallBlock(double *d, int n, int k0, int k1, int i0,
+                               int i1, int j0, int j1) {
+  for (int k = k0; k < k1; ++k) {
+    const double *colK = d + (size_t)k * n;
+    for (int j = j0; j < j1; ++j) {
+      double *colJ = d + (size_t)j * n;
+      double dkj = colJ[k];
+      if (dkj == std::numeric_limits<double>::infinity()) {
+        continue;
+      }
+      for (int i = i0; i < i1; ++i) {
+        double through = colK[i] + dkj;
+        if (through < colJ[i]) {
+          colJ[i] = through;
+        }
+      }
+    }
+  }
+}
+
+// Blocked Floyd-Warshall for all-pairs shortest paths on `h`. It runs in
+// O(n^3) regardless of the number of arcs, so it is mainly useful for small,
+// dense graphs. The matrix is processed in square tiles so that the working
+// set of each step stays in cache; within each round, the tiles that do not
+// depend on one another are spread over numThreads threads. The result has
+// the same layout as RunJohnson's.
+inline Rcpp::NumericMatrix
+RunFloydWarshall(const DigraphHandle &h,
+                 const std::vector<double> &arcDistances, int numThreads) {
+  const int BLOCK = 64;
+  const DigraphHandle::Digraph &g = h.g;
+  int n = h.nodes.size();
+  int NUM_ARCS = h.arcs.size();
+
+  Rcpp::NumericMatrix distances(n, n);
+  double *d = distances.begin();
+  std::fill(d, d + (size_t)n * n, std::numeric_limits<double>::infinity());
+  for (int i = 0; i < n; ++i) {
+    d[(size_t)i * n + i] = 0;
+  }
+  for (int a = 0; a < NUM_ARCS; ++a) {
+    int source = g.id(g.source(h.arcs[a]));
+    int target = g.id(g.target(h.arcs[a]));
+    double &dst = d[(size_t)target * n + source];
+    dst = std::min(dst, arcDistances[a]);
+  }
+
+  int numBlocks = (n + BLOCK - 1) / BLOCK;
+  for (int kb = 0; kb < numBlocks; ++kb) {
+    int k0 = kb * BLOCK, k1 = std::min(n, k0 + BLOCK);
+    // The diagonal tile, then the rest of its row and column of tiles, then
+    // everything else; each phase only reads tiles finished by the last one.
+    FloydWarshallBlock(d, n, k0, k1, k0, k1, k0, k1);
+    ParallelFor(2 * numBlocks, numThreads, [&](int task, int) {
+      int b = task / 2;
+      if (b == kb) {
+        return;
+      }
+      int b0 = b * BLOCK, b1 = std::min(n, b0 + BLOCK);
+      if (task % 2 == 0) {
+        FloydWarshallBlock(d, n, k0, k1, k0, k1, b0, b1);
+      } else {
+        FloydWarshallBlock(d, n, k0, k1, b0, b1, k0, k1);
+      }
+    });
+    ParallelFor(numBlocks * numBlocks, numThreads, [&](int task, int) {
+      int ib = task % numBlocks, jb = task / numBlocks;
+      if (ib == kb || jb == kb) {
+        return;
+      }
+      FloydWarshallBlock(d, n, k0, k1, ib * BLOCK,
+                         std::min(n, (ib + 1) * BLOCK), jb * BLOCK,
+                         std::min(n, (jb + 1) * BLOCK));
+    });
+  }
+
+  for (int i = 0; i < n; ++i) {
+    if (d[(size_t)i * n + i] < 0) {
+      Rcpp::stop("The graph contains a negative cycle.");
+    }
+  }
+  return distances;
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List SuurballeRunner(std::vector<int> arcSources,
+                           std::vector<int> arcTargets,
+                           std::vector<double> arcDistances, int numNodes,
+                           int startNode, int endNode) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  if (IsIntegral(arcDistances)) {
+    return RunSuurballe<int>(h, arcDistances, startNode, endNode);
+  }
+  return RunSuurballe<double>(h, arcDistances, startNode, endNode);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List SuurballeGraphRunner(SEXP graph, std::vector<double> arcDistances,
+                                int startNode, int endNode) {
+  const DigraphHandle &h = GetDigraph(graph);
+  if (IsIntegral(arcDistances)) {
+    return RunSuurballe<int>(h, arcDistances, startNode, endNode);
+  }
+  return RunSuurballe<double>(h, arcDistances, startNode, endNode);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List DijkstraRunner(std::vector<int> arcSources,
+                          std::vector<int> arcTargets,
+                          std::vector<double> arcDistances, int numNodes,
+                          int startNode, std::string heap) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  return RunDijkstra(h, arcDistances, startNode, heap);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List DijkstraGraphRunner(SEXP graph, std::vector<double> arcDistances,
+                               int startNode, std::string heap) {
+  return RunDijkstra(GetDigraph(graph), arcDistances, startNode, heap);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List DijkstraBatchRunner(std::vector<int> arcSources,
+                               std::vector<int> arcTargets,
+                               std::vector<double> arcDistances, int numNodes,
+                               std::vector<int> startNodes,
+                               bool predecessors, int numThreads,
+                               std::string heap) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  return RunDijkstraBatch(h, arcDistances, startNodes, predecessors,
+                          numThreads, heap);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List DijkstraBatchGraphRunner(SEXP graph,
+                                    std::vector<double> arcDistances,
+                                    std::vector<int> startNodes,
+                                    bool predecessors, int numThreads,
+                                    std::string heap) {
+  return RunDijkstraBatch(GetDigraph(graph), arcDistances, startNodes,
+                          predecessors, numThreads, heap);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List DijkstraPathRunner(std::vector<int> arcSources,
+                              std::vector<int> arcTargets,
+                              std::vector<double> arcDistances, int numNodes,
+                              int startNode, int endNode) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  if (IsIntegral(arcDistances)) {
+    return RunDijkstraPath<int>(h, arcDistances, startNode, endNode);
+  }
+  return RunDijkstraPath<double>(h, arcDistances, startNode, endNode);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List DijkstraPathGraphRunner(SEXP graph,
+                                   std::vector<double> arcDistances,
+                                   int startNode, int endNode) {
+  const DigraphHandle &h = GetDigraph(graph);
+  if (IsIntegral(arcDistances)) {
+    return RunDijkstraPath<int>(h, arcDistances, startNode, endNode);
+  }
+  return RunDijkstraPath<double>(h, arcDistances, startNode, endNode);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List BidirectionalDijkstraRunner(std::vector<int> arcSources,
+                                       std::vector<int> arcTargets,
+                                       std::vector<double> arcDistances,
+                                       int numNodes, int startNode,
+                                       int endNode) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  if (IsIntegral(arcDistances)) {
+    return RunBidirectionalDijkstra<int>(h, arcDistances, startNode, endNode);
+  }
+  return RunBidirectionalDijkstra<double>(h, arcDistances, startNode,
+                                          endNode);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List BidirectionalDijkstraGraphRunner(SEXP graph,
+                                            std::vector<double> arcDistances,
+                                            int startNode, int endNode) {
+  const DigraphHandle &h = GetDigraph(graph);
+  if (IsIntegral(arcDistances)) {
+    return RunBidirectionalDijkstra<int>(h, arcDistances, startNode, endNode);
+  }
+  return RunBidirectionalDijkstra<double>(h, arcDistances, startNode,
+                                          endNode);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List AStarRunner(std::vector<int> arcSources,
+                       std::vector<int> arcTargets,
+                       std::vector<double> arcDistances, int numNodes,
+                       int startNode, int endNode, std::vector<double> nodeX,
+                       std::vector<double> nodeY, std::string heuristic) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  if (IsIntegral(arcDistances)) {
+    return RunAStar<int>(h, arcDistances, nodeX, nodeY, startNode, endNode,
+                         heuristic);
+  }
+  return RunAStar<double>(h, arcDistances, nodeX, nodeY, startNode, endNode,
+                          heuristic);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List AStarGraphRunner(SEXP graph, std::vector<double> arcDistances,
+                            int startNode, int endNode,
+                            std::vector<double> nodeX,
+                            std::vector<double> nodeY, std::string heuristic) {
+  const DigraphHandle &h = GetDigraph(graph);
+  if (IsIntegral(arcDistances)) {
+    return RunAStar<int>(h, arcDistances, nodeX, nodeY, startNode, endNode,
+                         heuristic);
+  }
+  return RunAStar<double>(h, arcDistances, nodeX, nodeY, startNode, endNode,
+                          heuristic);
+}
+
 //' @rdname lemon_runners
 // [[Rcpp::export]]
 Rcpp::List BellmanFordRunner(std::vector<int> arcSources,
                              std::vector<int> arcTargets,
-                             std::vector<int> arcDistances, int numNodes,
+                             std::vector<double> arcDistances, int numNodes,
                              int startNode) {
-  ListDigraph g;
-  std::vector<ListDigraph::Node> nodes;
-  for (int i = 0; i < numNodes; ++i) {
-    ListDigraph::Node n = g.addNode();
-    nodes.push_back(n);
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  if (IsIntegral(arcDistances)) {
+    return RunBellmanFord<int>(h, arcDistances, startNode);
   }
-  ListDigraph::ArcMap<Cost> costs(g);
-  ListDigraph::NodeMap<Cost> dists(g);
-
-  std::vector<ListDigraph::Arc> arcs;
+  return RunBellmanFord<double>(h, arcDistances, startNode);
+}
 
-  int NUM_ARCS = arcSources.size();
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List BellmanFordGraphRunner(SEXP graph,
+                                  std::vector<double> arcDistances,
+                                  int startNode) {
+  const DigraphHandle &h = GetDigraph(graph);
+  if (IsIntegral(arcDistances)) {
+    return RunBellmanFord<int>(h, arcDistances, startNode);
+  }
+  return RunBellmanFord<double>(h, arcDistances, startNode);
+}
 
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    ListDigraph::Arc a =
-        g.addArc(nodes[arcSources[i] - 1], nodes[arcTargets[i] - 1]);
-    arcs.push_back(a);
-    costs[arcs[i]] = arcDistances[i];
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::NumericMatrix JohnsonRunner(std::vector<int> arcSources,
+                                  std::vector<int> arcTargets,
+                                  std::vector<double> arcDistances,
+                                  int numNodes, int numThreads) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  if (IsIntegral(arcDistances)) {
+    return RunJohnson<int>(h, arcDistances, numThreads);
   }
+  return RunJohnson<double>(h, arcDistances, numThreads);
+}
 
-  BellmanFord<ListDigraph, DigraphExtender<ListDigraphBase>::ArcMap<int> > bf =
-      BellmanFord<ListDigraph, DigraphExtender<ListDigraphBase>::ArcMap<int> >(
-          g, costs);
-  bf.run(nodes[startNode - 1]);
-  std::vector<int> distances;
-  std::vector<int> predecessors;
-  for (int i = 0; i < numNodes; i++) {
-    distances.push_back(bf.dist(nodes[i]));
-    predecessors.push_back(g.id(bf.predNode(nodes[i])) + 1);
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::NumericMatrix JohnsonGraphRunner(SEXP graph,
+                                       std::vector<double> arcDistances,
+                                       int numThreads) {
+  const DigraphHandle &h = GetDigraph(graph);
+  if (IsIntegral(arcDistances)) {
+    return RunJohnson<int>(h, arcDistances, numThreads);
   }
-  return Rcpp::List::create(distances, predecessors);
+  return RunJohnson<double>(h, arcDistances, numThreads);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::NumericMatrix FloydWarshallRunner(std::vector<int> arcSources,
+                                        std::vector<int> arcTargets,
+                                        std::vector<double> arcDistances,
+                                        int numNodes, int numThreads) {
+  DigraphHandle h;
+  BuildDigraph(h, arcSources, arcTargets, numNodes);
+  return RunFloydWarshall(h, arcDistances, numThreads);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::NumericMatrix FloydWarshallGraphRunner(SEXP graph,
+                                             std::vector<double> arcDistances,
+                                             int numThreads) {
+  return RunFloydWarshall(GetDigraph(graph), arcDistances, numThreads);
 }
@@ -0,0 +1,422 @@
+#ifndef RLEMON_STRONG_COMPONENTS_H
+#define RLEMON_STRONG_COMPONENTS_H
+
+#include "parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include <vector>
+
+// The out-arcs of a directed graph given as a list of arcs, in compressed
+// rows: the arcs of node v lead to heads[first[v]] up to
+// heads[first[v + 1] - 1]. With `reverse`, the in-arcs instead. Nodes are
+// numbered from 1 in `sources` and `targets`, as passed from R, and from 0
+// here. The arcs of each node are in the reverse of their input order, as
+// in the StaticDigraph built by BuildDigraph().
+inline void BuildArcRows(int numNodes, const std::vector<int> &sources,
+                         const std::vector<int> &targets, bool reverse,
+                         std::vector<int> &first, std::vector<int> &heads) {
+  const std::vector<int> &tails = reverse ? targets : sources;
+  const std::vector<int> &ends = reverse ? sources : targets;
+  int numArcs = tails.size();
+  first.assign(numNodes + 1, 0);
+  for (int i = 0; i < numArcs; ++i) {
+    ++first[tails[i] - 1];
+  }
+  for (int v = 1; v < numNodes; ++v) {
+    first[v] += first[v - 1];
+  }
+  heads.resize(numArcs);
+  for (int i = 0; i < numArcs; ++i) {
+    heads[--first[tails[i] - 1]] = ends[i] - 1;
+  }
+  first[numNodes] = numArcs;
+}
+
+// Finds the strongly connected components of a directed graph with
+// Pearce's space-efficient version of Tarjan's algorithm, without
+// recursion, so that deep graphs cannot overflow the stack.
+//
+// Besides the compressed rows of the graph, it keeps one int per node,
+// which holds the node's depth-first index while it is open and its
+// component once closed, a flag per node, the stack of open nodes and the
+// path of the search. The search visits the nodes and arcs in the order
+// LEMON's stronglyConnectedComponents() does on the StaticDigraph of
+// BuildDigraph(), and closes the components in the reverse of the order in
+// which LEMON's numbers them, so renumbering gives the same labels.
+class IterativeStrongComponents {
+public:
+  IterativeStrongComponents(int numNodes, const std::vector<int> &sources,
+                            const std::vector<int> &targets)
+      : numNodes(numNodes), sources(sources), targets(targets) {}
+
+  void run() {
+    std::vector<int> first, heads;
+    BuildArcRows(numNodes, sources, targets, false, first, heads);
+    run(first, heads);
+  }
+
+  // Runs on the out-arcs of the graph already built by BuildArcRows().
+  void run(const std::vector<int> &first, const std::vector<int> &heads) {
+    // Open nodes get indices counting up from 1, and closed components
+    // numbers counting down from numNodes - 1; an open node's index never
+    // exceeds the number of a closed component.
+    rindex.assign(numNodes, 0);
+    std::vector<char> isRoot(numNodes);
+    std::vector<int> open;
+    std::vector<std::pair<int, int> > path;
+    int index = 1, next = numNodes - 1;
+    for (int start = numNodes - 1; start >= 0; --start) {
+      if (rindex[start] != 0) {
+        continue;
+      }
+      rindex[start] = index++;
+      isRoot[start] = 1;
+      path.push_back(std::make_pair(start, first[start]));
+      while (!path.empty()) {
+        int v = path.back().first, arc = path.back().second;
+        if (arc < first[v + 1]) {
+          int w = heads[arc];
+          if (rindex[w] == 0) {
+            rindex[w] = index++;
+            isRoot[w] = 1;
+            path.push_back(std::make_pair(w, first[w]));
+            continue;
+          }
+          if (rindex[w] < rindex[v]) {
+            rindex[v] = rindex[w];
+            isRoot[v] = 0;
+          }
+          ++path.back().second;
+          continue;
+        }
+        path.pop_back();
+        if (isRoot[v]) {
+          --index;
+          while (!open.empty() && rindex[v] <= rindex[open.back()]) {
+            rindex[open.back()] = next;
+            open.pop_back();
+            --index;
+          }
+          rindex[v] = next--;
+        } else {
+          open.push_back(v);
+        }
+      }
+    }
+    componentCount = numNodes - 1 - next;
+  }
+
+  // The component of `node` (from 1 to numNodes); the components are
+  // numbered from 0.
+  int component(int node) const {
+    return rindex[node - 1] - (numNodes - componentCount);
+  }
+  int componentNum() const { return componentCount; }
+
+private:
+  int numNodes;
+  const std::vector<int> &sources, &targets;
+  std::vector<int> rindex;
+  int componentCount;
+};
+
+// Finds the strongly connected components of a directed graph over several
+// threads, by trimming, forward-backward search and coloring.
+//
+// Nodes without arcs in or out among the nodes left are components on
+// their own, and are trimmed away first. The component of the node with
+// the most arcs in and out, usually the largest, is then found as the
+// nodes both reached from it and reaching it, the two searches running at
+// once. The rest is colored: every node starts with a color of its own, a
+// scrambling of its number, and the largest color spreads along the arcs,
+// in parallel passes, until no color changes. Each node still of its own
+// color then gets as its component the nodes of that color reaching it,
+// with one backward search per color spread over the threads. Trimming and
+// coloring are repeated until every node has a component, or until a round
+// of coloring makes little progress, as on long chains of components,
+// when the nodes left are searched with IterativeStrongComponents instead.
+//
+// The components are numbered in the order of their last node, like those
+// of connectedComponents() on a StaticDigraph, rather than in the order of
+// LEMON's stronglyConnectedComponents().
+class ParallelStrongComponents {
+public:
+  ParallelStrongComponents(int numNodes, const std::vector<int> &sources,
+                           const std::vector<int> &targets, int numThreads)
+      : numNodes(numNodes), sources(sources), targets(targets),
+        numThreads(numThreads) {}
+
+  void run() {
+    BuildArcRows(numNodes, sources, targets, false, outFirst, outHeads);
+    BuildArcRows(numNodes, sources, targets, true, inFirst, inHeads);
+    // The node whose component each node is in, or -1 while unknown.
+    owner.assign(numNodes, -1);
+    numLeft = numNodes;
+
+    Trim();
+    SplitPivot();
+    std::vector<std::atomic<unsigned int> > color(numNodes);
+    std::vector<std::atomic<int> > queued(numNodes);
+    while (numLeft > 0) {
+      Trim();
+      if (numLeft == 0) {
+        break;
+      }
+      // Coloring peels only a few components a round off long chains of
+      // them, which a single search handles better.
+      int before = numLeft;
+      Color(color, queued);
+      if (numLeft > 0 && before - numLeft < before / SLOW_ROUND) {
+        FinishSerially();
+      }
+    }
+
+    label.assign(numNodes, -1);
+    std::vector<int> ownerLabel(numNodes, -1);
+    componentCount = 0;
+    for (int v = numNodes - 1; v >= 0; --v) {
+      int &l = ownerLabel[owner[v]];
+      if (l == -1) {
+        l = componentCount++;
+      }
+      label[v] = l;
+    }
+  }
+
+  // The component of `node` (from 1 to numNodes); the components are
+  // numbered from 0.
+  int component(int node) const { return label[node - 1]; }
+  int componentNum() const { return componentCount; }
+
+private:
+  // Nodes handed to a thread at a time by the coloring passes.
+  static const long long BLOCK_NODES = 1 << 12;
+  // A round of coloring finding components for less than this fraction of
+  // the nodes left ends the coloring.
+  static const int SLOW_ROUND = 16;
+
+  int numNodes;
+  const std::vector<int> &sources, &targets;
+  int numThreads;
+  std::vector<int> outFirst, outHeads, inFirst, inHeads;
+  std::vector<int> owner, label;
+  int numLeft, componentCount;
+
+  // Makes every node left with no arc in or no arc out from another node
+  // left a component of its own, until there are none.
+  void Trim() {
+    std::vector<int> inDegree(numNodes, 0), outDegree(numNodes, 0);
+    std::vector<int> queue;
+    for (int v = 0; v < numNodes; ++v) {
+      if (owner[v] != -1) {
+        continue;
+      }
+      for (int a = outFirst[v]; a < outFirst[v + 1]; ++a) {
+        int w = outHeads[a];
+        if (w != v && owner[w] == -1) {
+          ++outDegree[v];
+          ++inDegree[w];
+        }
+      }
+    }
+    for (int v = 0; v < numNodes; ++v) {
+      if (owner[v] == -1 && (inDegree[v] == 0 || outDegree[v] == 0)) {
+        owner[v] = v;
+        queue.push_back(v);
+      }
+    }
+    for (size_t q = 0; q < queue.size(); ++q) {
+      int v = queue[q];
+      --numLeft;
+      for (int a = outFirst[v]; a < outFirst[v + 1]; ++a) {
+        int w = outHeads[a];
+        if (owner[w] == -1 && w != v && --inDegree[w] == 0) {
+          owner[w] = w;
+          queue.push_back(w);
+        }
+      }
+      for (int a = inFirst[v]; a < inFirst[v + 1]; ++a) {
+        int w = inHeads[a];
+        if (owner[w] == -1 && w != v && --outDegree[w] == 0) {
+          owner[w] = w;
+          queue.push_back(w);
+        }
+      }
+    }
+  }
+
+  // Finds the component of the node left with the most arcs in and out.
+  void SplitPivot() {
+    int pivot = -1;
+    long long best = -1;
+    for (int v = 0; v < numNodes; ++v) {
+      long long degree = (long long)(outFirst[v + 1] - outFirst[v]) *
+                         (inFirst[v + 1] - inFirst[v]);
+      if (owner[v] == -1 && degree > best) {
+        best = degree;
+        pivot = v;
+      }
+    }
+    if (pivot == -1) {
+      return;
+    }
+    std::vector<char> forward(numNodes, 0), backward(numNodes, 0);
+    ParallelFor(2, numThreads, [&](int task, int) {
+      if (task == 0) {
+        Reach(pivot, outFirst, outHeads, forward);
+      } else {
+        Reach(pivot, inFirst, inHeads, backward);
+      }
+    });
+    for (int v = 0; v < numNodes; ++v) {
+      if (forward[v] && backward[v]) {
+        owner[v] = pivot;
+        --numLeft;
+      }
+    }
+  }
+
+  // Marks the nodes left reachable from `start` along the given arcs.
+  void Reach(int start, const std::vector<int> &first,
+             const std::vector<int> &heads, std::vector<char> &reached) const {
+    std::vector<int> queue(1, start);
+    reached[start] = 1;
+    for (size_t q = 0; q < queue.size(); ++q) {
+      int v = queue[q];
+      for (int a = first[v]; a < first[v + 1]; ++a) {
+        int w = heads[a];
+        if (!reached[w] && owner[w] == -1) {
+          reached[w] = 1;
+          queue.push_back(w);
+        }
+      }
+    }
+  }
+
+  // Finds the components of the nodes left with IterativeStrongComponents,
+  // on the graph they induce.
+  void FinishSerially() {
+    std::vector<int> nodes, index(numNodes, 0), s, t;
+    for (int v = 0; v < numNodes; ++v) {
+      if (owner[v] == -1) {
+        nodes.push_back(v);
+        index[v] = nodes.size();
+      }
+    }
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      int v = nodes[i];
+      for (int a = outFirst[v]; a < outFirst[v + 1]; ++a) {
+        if (index[outHeads[a]] != 0) {
+          s.push_back(i + 1);
+          t.push_back(index[outHeads[a]]);
+        }
+      }
+    }
+    IterativeStrongComponents search(nodes.size(), s, t);
+    search.run();
+    // The first node found in each component stands for it.
+    std::vector<int> first(search.componentNum(), -1);
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      int &f = first[search.component(i + 1)];
+      if (f == -1) {
+        f = nodes[i];
+      }
+      owner[nodes[i]] = f;
+    }
+    numLeft = 0;
+  }
+
+  // The color node v starts with: distinct for each node, never 0, and in
+  // no particular order. This is MurmurHash3's finalizer, a bijection of
+  // the 32-bit integers taking only 0 to 0.
+  static unsigned int Scramble(int v) {
+    unsigned int h = v + 1u;
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+  }
+
+  // One round of coloring, which finds at least one component. Nodes with a
+  // component already have color 0. Each pass only spreads the colors of
+  // the nodes whose color changed in the pass before, so a long path costs
+  // many small passes rather than many passes over every node.
+  void Color(std::vector<std::atomic<unsigned int> > &color,
+             std::vector<std::atomic<int> > &queued) {
+    std::vector<int> frontier;
+    for (int v = 0; v < numNodes; ++v) {
+      color[v].store(owner[v] == -1 ? Scramble(v) : 0,
+                     std::memory_order_relaxed);
+      queued[v].store(0, std::memory_order_relaxed);
+      if (owner[v] == -1) {
+        frontier.push_back(v);
+      }
+    }
+    std::vector<std::vector<int> > changed(NumWorkers(numThreads, numNodes));
+    for (int pass = 1; !frontier.empty(); ++pass) {
+      long long size = frontier.size();
+      int numBlocks = (size + BLOCK_NODES - 1) / BLOCK_NODES;
+      ParallelFor(numBlocks, numThreads, [&](int block, int worker) {
+        long long end = std::min(size, (block + 1) * BLOCK_NODES);
+        for (long long i = block * BLOCK_NODES; i < end; ++i) {
+          int v = frontier[i];
+          unsigned int c = color[v].load(std::memory_order_relaxed);
+          for (int a = outFirst[v]; a < outFirst[v + 1]; ++a) {
+            int w = outHeads[a];
+            unsigned int old = color[w].load(std::memory_order_relaxed);
+            while (old != 0 && old < c &&
+                   !color[w].compare_exchange_weak(
+                       old, c, std::memory_order_relaxed)) {
+            }
+            if (old != 0 && old < c &&
+                queued[w].exchange(pass, std::memory_order_relaxed) != pass) {
+              changed[worker].push_back(w);
+            }
+          }
+        }
+      });
+      frontier.clear();
+      for (size_t k = 0; k < changed.size(); ++k) {
+        frontier.insert(frontier.end(), changed[k].begin(), changed[k].end());
+        changed[k].clear();
+      }
+    }
+
+    // Each color's own node collects the nodes of its color reaching it;
+    // no other search touches the nodes of that color.
+    std::vector<int> roots;
+    for (int v = 0; v < numNodes; ++v) {
+      if (color[v].load(std::memory_order_relaxed) == Scramble(v)) {
+        roots.push_back(v);
+      }
+    }
+    std::vector<int> found(roots.size());
+    ParallelFor(roots.size(), numThreads, [&](int task, int) {
+      int root = roots[task];
+      unsigned int rootColor = Scramble(root);
+      std::vector<int> queue(1, root);
+      owner[root] = root;
+      for (size_t q = 0; q < queue.size(); ++q) {
+        int v = queue[q];
+        for (int a = inFirst[v]; a < inFirst[v + 1]; ++a) {
+          int w = inHeads[a];
+          if (color[w].load(std::memory_order_relaxed) == rootColor &&
+              owner[w] == -1) {
+            owner[w] = root;
+            queue.push_back(w);
+          }
+        }
+      }
+      found[task] = queue.size();
+    });
+    for (size_t r = 0; r < roots.size(); ++r) {
+      numLeft -= found[r];
+    }
+  }
+};
+
+#endif // RLEMON_STRONG_COMPONENTS_H
@@ -1,3 +1,4 @@
+#include "value_type.h"
 #include <lemon/christofides_tsp.h>
 #include <lemon/greedy_tsp.h>
 #include <lemon/insertion_tsp.h>
@@ -10,21 +11,18 @@ typedef int Value;
 using namespace lemon;
 using namespace std;
 
-
-//' @rdname lemon_runners
-// [[Rcpp::export]]
-Rcpp::List ChristofidesRunner(std::vector<int> arcSources,
-                              std::vector<int> arcTargets,
-                              std::vector<int> arcDistances, int numNodes,
-                              int defaultEdgeWeight = 999999) {
-  // Requires: Two std::vectors, arcSources and arcTargets, each of which take integers to index specific nodes and, as pairs, consitute arcs in our graph
-  //           One std::vector, arcDistances, which assigns for each arc an associated distance
-  //           Two ints, numNodes and startnode, which give us the number of nodes in the directed graph and the starting node for Bellman Ford
-  // Returns: One std::vector, which contains the minimum distances from the start node to each of the nodes, with "-1" used as a placeholder to indicates the target and source and disjoint
-  // ATTENTION: TSP implemented using fullgraph, so remember that all edges exist
+// Runs the LEMON TSP heuristic `TSP` (ChristofidesTsp, GreedyTsp,
+// InsertionTsp, NearestNeighborTsp or Opt2Tsp) with edge costs of type
+// `Value`. The TSP classes work on a FullGraph, so every pair of nodes is
+// joined; edges not given in the input cost defaultEdgeWeight.
+template <template <typename> class TSP, typename Value>
+inline Rcpp::List RunTsp(const std::vector<int> &arcSources,
+                         const std::vector<int> &arcTargets,
+                         const std::vector<double> &arcDistances, int numNodes,
+                         double defaultEdgeWeight) {
   FullGraph g(numNodes);
 
-  FullGraph::EdgeMap<int> costs(g, defaultEdgeWeight);
+  FullGraph::EdgeMap<Value> costs(g, defaultEdgeWeight);
 
   int NUM_ARCS = arcSources.size();
 
@@ -32,7 +30,7 @@ Rcpp::List ChristofidesRunner(std::vector<int> arcSources,
     costs[g.arc(g(arcSources[i] - 1), g(arcTargets[i] - 1))] = arcDistances[i];
   }
 
-  ChristofidesTsp<FullGraph::EdgeMap<int> > runner(g, costs);
+  TSP<FullGraph::EdgeMap<Value> > runner(g, costs);
   runner.run();
 
   std::vector<int> tour;
@@ -43,130 +41,68 @@ Rcpp::List ChristofidesRunner(std::vector<int> arcSources,
   return Rcpp::List::create(tour, runner.tourCost());
 }
 
+// Runs RunTsp on int costs when the costs and defaultEdgeWeight are all
+// integers and on double costs otherwise.
+template <template <typename> class TSP>
+inline Rcpp::List RunTspValue(const std::vector<int> &arcSources,
+                              const std::vector<int> &arcTargets,
+                              const std::vector<double> &arcDistances,
+                              int numNodes, double defaultEdgeWeight) {
+  if (IsIntegral(arcDistances) && IsIntegral(defaultEdgeWeight)) {
+    return RunTsp<TSP, int>(arcSources, arcTargets, arcDistances, numNodes,
+                            defaultEdgeWeight);
+  }
+  return RunTsp<TSP, double>(arcSources, arcTargets, arcDistances, numNodes,
+                             defaultEdgeWeight);
+}
+
+//' @rdname lemon_runners
+// [[Rcpp::export]]
+Rcpp::List ChristofidesRunner(std::vector<int> arcSources,
+                              std::vector<int> arcTargets,
+                              std::vector<double> arcDistances, int numNodes,
+                              double defaultEdgeWeight = 999999) {
+  return RunTspValue<ChristofidesTsp>(arcSources, arcTargets, arcDistances,
+                                      numNodes, defaultEdgeWeight);
+}
+
 //' @rdname lemon_runners
 // [[Rcpp::export]]
 Rcpp::List GreedyTSPRunner(std::vector<int> arcSources,
                            std::vector<int> arcTargets,
-                           std::vector<int> arcDistances, int numNodes,
-                           int defaultEdgeWeight = 999999) {
-  // Requires: Two std::vectors, arcSources and arcTargets, each of which take integers to index specific nodes and, as pairs, consitute arcs in our graph
-  //           One std::vector, arcDistances, which assigns for each arc an associated distance
-  //           Two ints, numNodes and startnode, which give us the number of nodes in the directed graph and the starting node for Bellman Ford
-  // Returns: One std::vector, which contains the minimum distances from the start node to each of the nodes, with "-1" used as a placeholder to indicates the target and source and disjoint
-  // ATTENTION: TSP implemented using fullgraph, so remember that we can't test this for large n.
-  FullGraph g(numNodes);
-
-  FullGraph::EdgeMap<int> costs(g, defaultEdgeWeight);
-
-  int NUM_ARCS = arcSources.size();
-
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    costs[g.arc(g(arcSources[i] - 1), g(arcTargets[i] - 1))] = arcDistances[i];
-  }
-
-  GreedyTsp<FullGraph::EdgeMap<int> > runner(g, costs);
-  runner.run();
-
-  std::vector<int> tour;
-  for (int i = 0; i < numNodes; ++i) {
-    tour.push_back(g.id(runner.tourNodes()[i]) + 1);
-  }
-
-  return Rcpp::List::create(tour, runner.tourCost());
+                           std::vector<double> arcDistances, int numNodes,
+                           double defaultEdgeWeight = 999999) {
+  return RunTspValue<GreedyTsp>(arcSources, arcTargets, arcDistances, numNodes,
+                                defaultEdgeWeight);
 }
 
 //' @rdname lemon_runners
 // [[Rcpp::export]]
 Rcpp::List InsertionTSPRunner(std::vector<int> arcSources,
                               std::vector<int> arcTargets,
-                              std::vector<int> arcDistances, int numNodes,
-                              int defaultEdgeWeight = 999999) {
-  // Requires: Two std::vectors, arcSources and arcTargets, each of which take integers to index specific nodes and, as pairs, consitute arcs in our graph
-  //           One std::vector, arcDistances, which assigns for each arc an associated distance
-  //           Two ints, numNodes and startnode, which give us the number of nodes in the directed graph and the starting node for Bellman Ford
-  // Returns: One std::vector, which contains the minimum distances from the start node to each of the nodes, with "-1" used as a placeholder to indicates the target and source and disjoint
-  // ATTENTION: TSP implemented using fullgraph, so remember that we can't test this for large n.
-  FullGraph g(numNodes);
-
-  FullGraph::EdgeMap<int> costs(g, defaultEdgeWeight);
-
-  int NUM_ARCS = arcSources.size();
-
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    costs[g.arc(g(arcSources[i] - 1), g(arcTargets[i] - 1))] = arcDistances[i];
-  }
-
-  InsertionTsp<FullGraph::EdgeMap<int> > runner(g, costs);
-  runner.run();
-
-  std::vector<int> tour;
-  for (int i = 0; i < numNodes; ++i) {
-    tour.push_back(g.id(runner.tourNodes()[i]) + 1);
-  }
-
-  return Rcpp::List::create(tour, runner.tourCost());
+                              std::vector<double> arcDistances, int numNodes,
+                              double defaultEdgeWeight = 999999) {
+  return RunTspValue<InsertionTsp>(arcSources, arcTargets, arcDistances,
+                                   numNodes, defaultEdgeWeight);
 }
 
 //' @rdname lemon_runners
 // [[Rcpp::export]]
 Rcpp::List NearestNeighborTSPRunner(std::vector<int> arcSources,
                                     std::vector<int> arcTargets,
-                                    std::vector<int> arcDistances, int numNodes,
-                                    int defaultEdgeWeight = 999999) {
-  // Requires: Two std::vectors, arcSources and arcTargets, each of which take integers to index specific nodes and, as pairs, consitute arcs in our graph
-  //           One std::vector, arcDistances, which assigns for each arc an associated distance
-  //           Two ints, numNodes and startnode, which give us the number of nodes in the directed graph and the starting node for Bellman Ford
-  // Returns: One std::vector, which contains the minimum distances from the start node to each of the nodes, with "-1" used as a placeholder to indicates the target and source and disjoint
-  // ATTENTION: TSP implemented using fullgraph, so remember that we can't test this for large n.
-  FullGraph g(numNodes);
-
-  FullGraph::EdgeMap<int> costs(g, defaultEdgeWeight);
-
-  int NUM_ARCS = arcSources.size();
-
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    costs[g.arc(g(arcSources[i] - 1), g(arcTargets[i] - 1))] = arcDistances[i];
-  }
-
-  NearestNeighborTsp<FullGraph::EdgeMap<int> > runner(g, costs);
-  runner.run();
-
-  std::vector<int> tour;
-  for (int i = 0; i < numNodes; ++i) {
-    tour.push_back(g.id(runner.tourNodes()[i]) + 1);
-  }
-
-  return Rcpp::List::create(tour, runner.tourCost());
+                                    std::vector<double> arcDistances,
+                                    int numNodes,
+                                    double defaultEdgeWeight = 999999) {
+  return RunTspValue<NearestNeighborTsp>(arcSources, arcTargets, arcDistances,
+                                         numNodes, defaultEdgeWeight);
 }
 
 //' @rdname lemon_runners
 // [[Rcpp::export]]
 Rcpp::List Opt2TSPRunner(std::vector<int> arcSources,
                          std::vector<int> arcTargets,
-                         std::vector<int> arcDistances, int numNodes,
-                         int defaultEdgeWeight = 999999) {
-  // Requires: Two std::vectors, arcSources and arcTargets, each of which take integers to index specific nodes and, as pairs, consitute arcs in our graph
-  //           One std::vector, arcDistances, which assigns for each arc an associated distance
-  //           Two ints, numNodes and startnode, which give us the number of nodes in the directed graph and the starting node for Bellman Ford
-  // Returns: One std::vector, which contains the minimum distances from the start node to each of the nodes, with "-1" used as a placeholder to indicates the target and source and disjoint
-  // ATTENTION: TSP implemented using fullgraph, so remember that we can't test this for large n.
-  FullGraph g(numNodes);
-
-  FullGraph::EdgeMap<int> costs(g, defaultEdgeWeight);
-
-  int NUM_ARCS = arcSources.size();
-
-  for (int i = 0; i < NUM_ARCS; ++i) {
-    costs[g.arc(g(arcSources[i] - 1), g(arcTargets[i] - 1))] = arcDistances[i];
-  }
-
-  Opt2Tsp<FullGraph::EdgeMap<int> > runner(g, costs);
-  runner.run();
-
-  std::vector<int> tour;
-  for (int i = 0; i < numNodes; ++i) {
-    tour.push_back(g.id(runner.tourNodes()[i]) + 1);
-  }
-
-  return Rcpp::List::create(tour, runner.tourCost());
+                         std::vector<double> arcDistances, int numNodes,
+                         double defaultEdgeWeight = 999999) {
+  return RunTspValue<Opt2Tsp>(arcSources, arcTargets, arcDistances, numNodes,
+                              defaultEdgeWeight);
 }
@@ -0,0 +1,42 @@
+#ifndef RLEMON_VALUE_TYPE_H
+#define RLEMON_VALUE_TYPE_H
+
+#include <Rcpp.h>
+#include <climits>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Arc and node values (distances, capacities, costs, weights and supplies)
+// are passed from R as doubles. Runners solve on int when every value is a
+// whole number that fits in an int, so that integer input keeps exact integer
+// arithmetic and integer results, and on double otherwise.
+inline bool IsIntegral(double x) {
+  return x >= INT_MIN && x <= INT_MAX && x == std::floor(x);
+}
+
+inline bool IsIntegral(const std::vector<double> &values) {
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (!IsIntegral(values[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// For algorithms that only work on integers: stops with an error naming
+// `what` unless every value is a whole number that a double represents
+// exactly (magnitude at most 2^53), so that it converts to long long without
+// loss.
+inline void RequireIntegral(const std::vector<double> &values,
+                            const std::string &what) {
+  const double MAX_EXACT = 9007199254740992.0;
+  for (size_t i = 0; i < values.size(); ++i) {
+    double x = values[i];
+    if (!(std::fabs(x) <= MAX_EXACT) || x != std::floor(x)) {
+      Rcpp::stop(what + " must be integers.");
+    }
+  }
+}
+
+#endif